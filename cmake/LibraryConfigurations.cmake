@@ -116,6 +116,12 @@ elseif ("${PLATFORM}" MATCHES "NX")
     set(LIBS_PRIVATE ${EGL} ${GLESV2} ${GLAPI} ${DRM} ${LIBNX} pthread m stdc++)
     link_libraries("${LIBS_PRIVATE}")
 
+elseif ("${PLATFORM}" MATCHES "Null")
+    set(PLATFORM_CPP "PLATFORM_NULL")
+    set(GRAPHICS "GRAPHICS_API_OPENGL_33")
+
+    set(LIBS_PRIVATE m pthread dl)
+
 endif ()
 
 if (NOT ${OPENGL_VERSION} MATCHES "OFF")
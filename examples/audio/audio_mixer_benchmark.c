@@ -0,0 +1,161 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - mixer benchmark
+*
+*   Mixes many voices (sounds and sound instances) with different volume and pan in offline mode
+*   and reports mixer time, no audio device is required, so it can be run on headless systems
+*
+*   Sounds are float data, mixed straight from sound data, then signed 16 bit audio streams are mixed,
+*   their frames are converted to float before the data converter
+*
+*   NOTE: Build raylib with RAUDIO_NO_SIMD defined to measure the scalar mixer kernels
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>                         // Required for: calloc(), free()
+#include <math.h>                           // Required for: sinf()
+#include <time.h>                           // Required for: clock()
+
+#define SAMPLE_RATE             48000       // Mixer sample rate
+#define PERIOD_FRAMES             480       // Frames rendered per mixer period (10 ms)
+#define BENCHMARK_SOUNDS           32       // Sounds played, every sound is also played as instances
+#define BENCHMARK_INSTANCES         2       // Sound instances played per sound (voices pool)
+#define BENCHMARK_STREAMS          32       // Signed 16 bit audio streams played
+#define BENCHMARK_SECONDS          60       // Mixed audio length, in seconds
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    InitAudioDeviceEx((AudioDeviceConfig){ .sampleRate = SAMPLE_RATE, .periodFrames = PERIOD_FRAMES, .offline = true });
+
+    // Every sound is one second long, a different tone, so all voices are restarted every second
+    float *samples = (float *)calloc(SAMPLE_RATE*2, sizeof(float));
+    Sound sounds[BENCHMARK_SOUNDS] = { 0 };
+
+    for (int i = 0; i < BENCHMARK_SOUNDS; i++)
+    {
+        for (int f = 0; f < SAMPLE_RATE; f++)
+        {
+            samples[f*2] = 0.5f*sinf(2.0f*PI*(110.0f + 20.0f*i)*(float)f/SAMPLE_RATE);
+            samples[f*2 + 1] = samples[f*2];
+        }
+
+        Wave wave = { .frameCount = SAMPLE_RATE, .sampleRate = SAMPLE_RATE, .sampleSize = 32, .channels = 2, .data = samples };
+        sounds[i] = LoadSoundFromWave(wave);
+        SetSoundVolume(sounds[i], 0.2f + 0.6f*(float)i/BENCHMARK_SOUNDS);
+        SetSoundPan(sounds[i], (float)i/(BENCHMARK_SOUNDS - 1));
+    }
+
+    free(samples);
+
+    // Streams are fed with one second long tones, signed 16 bit
+    short *pcm = (short *)calloc(SAMPLE_RATE*2, sizeof(short));
+    AudioStream streams[BENCHMARK_STREAMS] = { 0 };
+
+    for (int f = 0; f < SAMPLE_RATE; f++)
+    {
+        pcm[f*2] = (short)(16000.0f*sinf(2.0f*PI*220.0f*(float)f/SAMPLE_RATE));
+        pcm[f*2 + 1] = pcm[f*2];
+    }
+
+    for (int i = 0; i < BENCHMARK_STREAMS; i++)
+    {
+        streams[i] = LoadAudioStream(SAMPLE_RATE, 16, 2);
+        SetAudioStreamVolume(streams[i], 1.0f/BENCHMARK_STREAMS);
+        SetAudioStreamPan(streams[i], (float)i/(BENCHMARK_STREAMS - 1));
+    }
+
+    float frames[PERIOD_FRAMES*2] = { 0 };
+    unsigned int voicesMax = 0;
+    //--------------------------------------------------------------------------------------
+
+    // Mix all voices for the benchmark length
+    //--------------------------------------------------------------------------------------
+    ResetAudioStats();
+    clock_t start = clock();
+
+    for (int second = 0; second < BENCHMARK_SECONDS; second++)
+    {
+        for (int i = 0; i < BENCHMARK_SOUNDS; i++)
+        {
+            PlaySound(sounds[i]);
+
+            for (int n = 0; n < BENCHMARK_INSTANCES; n++)
+            {
+                unsigned int instance = PlaySoundInstance(sounds[i], 0);
+                SetSoundInstancePan(instance, (float)n/(BENCHMARK_INSTANCES - 1));
+            }
+        }
+
+        for (int f = 0; f < (SAMPLE_RATE/PERIOD_FRAMES); f++)
+        {
+            RenderAudioFrames(frames, PERIOD_FRAMES);
+
+            unsigned int voices = GetAudioStats().activeVoices;
+            if (voices > voicesMax) voicesMax = voices;
+        }
+    }
+
+    double elapsed = (double)(clock() - start)/CLOCKS_PER_SEC;
+    AudioStats stats = GetAudioStats();
+    //--------------------------------------------------------------------------------------
+
+    // Mix signed 16 bit streams for the benchmark length, sounds finished
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < BENCHMARK_STREAMS; i++) PlayAudioStream(streams[i]);
+
+    ResetAudioStats();
+    clock_t streamsStart = clock();
+
+    for (int second = 0; second < BENCHMARK_SECONDS; second++)
+    {
+        for (int f = 0; f < (SAMPLE_RATE/PERIOD_FRAMES); f++)
+        {
+            for (int i = 0; i < BENCHMARK_STREAMS; i++) PushAudioStreamFrames(streams[i], pcm + f*PERIOD_FRAMES*2, PERIOD_FRAMES);
+
+            RenderAudioFrames(frames, PERIOD_FRAMES);
+        }
+    }
+
+    double streamsElapsed = (double)(clock() - streamsStart)/CLOCKS_PER_SEC;
+    AudioStats streamsStats = GetAudioStats();
+    //--------------------------------------------------------------------------------------
+
+    // Report results
+    //--------------------------------------------------------------------------------------
+    double mixed = (double)stats.callbackCount*PERIOD_FRAMES/SAMPLE_RATE;
+
+    TraceLog(LOG_INFO, "BENCHMARK: %u voices mixed, %.1f seconds of audio in %.3f seconds (%.0fx real time)", voicesMax, mixed, elapsed, mixed/elapsed);
+    TraceLog(LOG_INFO, "BENCHMARK: Mixer period: %.2f us average, %.2f us max, %.3f%% load", stats.callbackTimeAvg*1000000.0f, stats.callbackTimeMax*1000000.0f, stats.callbackLoad*100.0f);
+    TraceLog(LOG_INFO, "BENCHMARK: Mixer time per voice frame: %.2f ns", stats.callbackTimeAvg*1000000000.0/((double)voicesMax*PERIOD_FRAMES));
+
+    double streamsMixed = (double)streamsStats.callbackCount*PERIOD_FRAMES/SAMPLE_RATE;
+
+    TraceLog(LOG_INFO, "BENCHMARK: %i signed 16 bit streams mixed, %.1f seconds of audio in %.3f seconds (%.0fx real time)", BENCHMARK_STREAMS, streamsMixed, streamsElapsed, streamsMixed/streamsElapsed);
+    TraceLog(LOG_INFO, "BENCHMARK: Mixer time per stream frame: %.2f ns", streamsStats.callbackTimeAvg*1000000000.0/((double)BENCHMARK_STREAMS*PERIOD_FRAMES));
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    for (int i = 0; i < BENCHMARK_SOUNDS; i++) UnloadSound(sounds[i]);
+    for (int i = 0; i < BENCHMARK_STREAMS; i++) UnloadAudioStream(streams[i]);
+    free(pcm);
+
+    CloseAudioDevice();     // Close audio device
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - mixer stress test
+*
+*   Several program threads hammer the audio API (play, stop, pause, parameters, instances,
+*   scheduled starts and aliases loading) while a render thread drives the mixer in offline mode,
+*   no audio device is required, so it can be run on headless systems
+*
+*   Checks:
+*     - Scheduled sounds are never audible before their scheduled audio clock frame
+*     - Sounds are reported playing right after PlaySound() and not playing right after StopSound()
+*     - Mixed output stays finite and it is silent once all sounds are unloaded
+*
+*   Program returns 0 if all checks passed
+*
+*   NOTE: This example requires linking with pthreads library on MinGW,
+*   it can be accomplished passing -static parameter to compiler
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+// WARNING: This example does not build on Windows with MSVC compiler
+#include "pthread.h"                        // POSIX style threads management
+#include <sched.h>                          // Required for: sched_yield()
+
+#include <stdatomic.h>                      // C11 atomic data types
+
+#include <stdlib.h>                         // Required for: calloc(), free()
+#include <math.h>                           // Required for: fabsf(), isfinite()
+
+#define SAMPLE_RATE             48000       // Mixer sample rate
+#define PERIOD_FRAMES             256       // Frames rendered per mixer period
+#define TONE_FRAMES       (SAMPLE_RATE/2)   // Tone length in frames, half a second
+
+#define PROGRAM_THREADS             4       // Threads calling the audio API
+#define PROGRAM_OPERATIONS     100000       // Audio API calls per program thread
+#define SHARED_SOUNDS               4       // Sounds used by all program threads
+
+#define SCHEDULED_TRIALS        10000       // Scheduled starts checked
+#define SCHEDULED_AHEAD             8       // Scheduled start distance, in periods
+
+#define RING_FRAMES             65536       // Rendered frames peaks history (power of 2)
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static Sound tone = { 0 };                  // DC tone, every frame is audible (non-zero)
+static Sound shared[SHARED_SOUNDS] = { 0 }; // Sounds shared by program threads
+
+static float ring[RING_FRAMES] = { 0 };     // Rendered frames peaks, by audio clock frame
+static atomic_ullong framesPublished = 0;   // Audio clock frame up to which peaks are published
+static atomic_ullong renderLimit = 0;       // Audio clock frame where render thread waits (0 for no limit)
+static atomic_bool renderRunning = true;    // Render thread running
+
+static atomic_int nonFiniteSamples = 0;     // Mixed samples not finite (NaN or infinity)
+static atomic_int stateErrors = 0;          // Sounds playing state reported wrong
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void *RenderThread(void *arg);       // Mixer render thread, offline mode
+static void *ProgramThread(void *arg);      // Program thread, random audio API calls
+static void YieldProcessor(void *buffer, unsigned int frames);  // Audio processor yielding the CPU in the middle of the mix
+static unsigned int GetRandomNext(unsigned int *state);   // Per-thread random generator (xorshift)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    InitAudioDeviceEx((AudioDeviceConfig){ .sampleRate = SAMPLE_RATE, .periodFrames = PERIOD_FRAMES, .offline = true });
+
+    // Tone is a constant signal, any frame mixed from it is non-zero
+    float *samples = (float *)calloc(TONE_FRAMES*2, sizeof(float));
+    for (int i = 0; i < TONE_FRAMES*2; i++) samples[i] = 0.25f;
+
+    Wave wave = { .frameCount = TONE_FRAMES, .sampleRate = SAMPLE_RATE, .sampleSize = 32, .channels = 2, .data = samples };
+    for (int i = 0; i < SHARED_SOUNDS; i++) shared[i] = LoadSoundFromWave(wave);
+    tone = LoadSoundFromWave(wave);     // Mixed after shared sounds
+    free(samples);
+
+    pthread_t renderThread = { 0 };
+    pthread_create(&renderThread, NULL, RenderThread, NULL);
+    //--------------------------------------------------------------------------------------
+
+    // Check scheduled starts: tone must be silent until its scheduled frame
+    //--------------------------------------------------------------------------------------
+    int earlyStarts = 0;
+    int lateStarts = 0;
+    unsigned int random = 0x12345678;
+
+    // Shared sounds are played muted and resampled before tone in every period, like in a real mix
+    // NOTE: Processor yields the CPU while a period is mixed, so program threads run in the middle of it (even on a single core)
+    for (int i = 0; i < SHARED_SOUNDS; i++)
+    {
+        SetSoundVolume(shared[i], 0.0f);
+        SetSoundPitch(shared[i], 1.01f);
+    }
+
+    AttachAudioStreamProcessor(shared[0].stream, YieldProcessor);
+
+    for (int trial = 0; trial < SCHEDULED_TRIALS; trial++)
+    {
+        for (int i = 0; i < SHARED_SOUNDS; i++) if (!IsSoundPlaying(shared[i])) PlaySound(shared[i]);
+
+        // Tone is stopped, render thread waits once the stop has been mixed
+        StopSound(tone);
+
+        unsigned long long stopped = GetAudioClockFrames() + 2*PERIOD_FRAMES;
+        atomic_store(&renderLimit, stopped);
+        while (atomic_load(&framesPublished) < stopped) sched_yield();
+
+        // Tone is scheduled while the render thread is mixing, so mixer periods run concurrently
+        unsigned long long issued = GetAudioClockFrames();
+        unsigned long long target = issued + SCHEDULED_AHEAD*PERIOD_FRAMES + GetRandomNext(&random)%PERIOD_FRAMES;
+
+        // Tone is scheduled at a random point of the periods being mixed
+        atomic_store(&renderLimit, target + 2*PERIOD_FRAMES);
+        for (unsigned int i = GetRandomNext(&random)%3; i > 0; i--) sched_yield();
+        PlaySoundScheduled(tone, target);
+
+        if (!IsSoundPlaying(tone)) atomic_fetch_add(&stateErrors, 1);   // Reported playing while waiting
+
+        while (atomic_load(&framesPublished) < (target + 2*PERIOD_FRAMES)) sched_yield();
+
+        bool early = false;
+        for (unsigned long long frame = issued; frame < target; frame++) if (ring[frame%RING_FRAMES] != 0.0f) early = true;
+
+        if (early) earlyStarts++;
+        else if (ring[target%RING_FRAMES] == 0.0f) lateStarts++;  // Scheduled frame already rendered when tone was scheduled
+    }
+
+    StopSound(tone);
+    atomic_store(&renderLimit, 0);
+
+    TraceLog(LOG_INFO, "STRESS: Scheduled starts: %i trials, %i early, %i late", SCHEDULED_TRIALS, earlyStarts, lateStarts);
+    //--------------------------------------------------------------------------------------
+
+    // Hammer audio API from several threads while mixer is rendering
+    //--------------------------------------------------------------------------------------
+    pthread_t programThreads[PROGRAM_THREADS] = { 0 };
+    unsigned int seeds[PROGRAM_THREADS] = { 0 };
+
+    for (int i = 0; i < PROGRAM_THREADS; i++)
+    {
+        seeds[i] = 0x9e3779b9u*(i + 1);
+        pthread_create(&programThreads[i], NULL, ProgramThread, &seeds[i]);
+    }
+
+    for (int i = 0; i < PROGRAM_THREADS; i++) pthread_join(programThreads[i], NULL);
+
+    AudioStats stats = GetAudioStats();
+    TraceLog(LOG_INFO, "STRESS: API calls: %i threads x %i calls, %llu mixer periods rendered", PROGRAM_THREADS, PROGRAM_OPERATIONS, stats.callbackCount);
+    //--------------------------------------------------------------------------------------
+
+    // Check output is silent once all sounds are unloaded (voices stopped along with them)
+    //--------------------------------------------------------------------------------------
+    DetachAudioStreamProcessor(shared[0].stream, YieldProcessor);
+
+    for (int i = 0; i < SHARED_SOUNDS; i++) UnloadSound(shared[i]);
+    UnloadSound(tone);
+
+    unsigned long long unloaded = GetAudioClockFrames() + 2*PERIOD_FRAMES;
+    unsigned long long checked = unloaded + 8*PERIOD_FRAMES;
+    atomic_store(&renderLimit, checked);
+    while (atomic_load(&framesPublished) < checked) sched_yield();
+
+    bool silent = true;
+    for (unsigned long long frame = unloaded; frame < checked; frame++) if (ring[frame%RING_FRAMES] != 0.0f) silent = false;
+
+    atomic_store(&renderRunning, false);
+    atomic_store(&renderLimit, 0);
+    pthread_join(renderThread, NULL);
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    CloseAudioDevice();     // Close audio device
+    //--------------------------------------------------------------------------------------
+
+    int failures = earlyStarts + atomic_load(&stateErrors) + atomic_load(&nonFiniteSamples) + (silent? 0 : 1);
+
+    TraceLog(LOG_INFO, "STRESS: State errors: %i, non-finite samples: %i, silent after unloading: %s",
+        atomic_load(&stateErrors), atomic_load(&nonFiniteSamples), silent? "yes" : "no");
+
+    if (failures == 0) TraceLog(LOG_INFO, "STRESS: All checks passed");
+    else TraceLog(LOG_WARNING, "STRESS: Checks failed");
+
+    return (failures == 0)? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+
+// Mixer render thread, renders periods and publishes every frame peak by audio clock frame
+static void *RenderThread(void *arg)
+{
+    float frames[PERIOD_FRAMES*2] = { 0 };
+
+    while (atomic_load(&renderRunning))
+    {
+        // Only this thread renders, audio clock does not change until next period is rendered
+        unsigned long long clock = GetAudioClockFrames();
+        unsigned long long limit = atomic_load(&renderLimit);
+
+        if ((limit > 0) && (clock >= limit))
+        {
+            sched_yield();
+            continue;
+        }
+
+        RenderAudioFrames(frames, PERIOD_FRAMES);
+
+        for (int i = 0; i < PERIOD_FRAMES; i++)
+        {
+            float left = frames[2*i];
+            float right = frames[2*i + 1];
+
+            if (!isfinite(left) || !isfinite(right)) atomic_fetch_add(&nonFiniteSamples, 1);
+
+            ring[(clock + i)%RING_FRAMES] = (fabsf(left) > fabsf(right))? fabsf(left) : fabsf(right);
+        }
+
+        atomic_store(&framesPublished, clock + PERIOD_FRAMES);
+    }
+
+    return NULL;
+}
+
+// Audio processor yielding the CPU in the middle of the mix
+static void YieldProcessor(void *buffer, unsigned int frames)
+{
+    sched_yield();
+}
+
+// Program thread, random audio API calls on shared sounds and checks on its own sound alias
+static void *ProgramThread(void *arg)
+{
+    unsigned int *random = (unsigned int *)arg;
+    Sound own = LoadSoundAlias(tone);       // Only used by this thread, its state can be checked
+
+    for (int i = 0; i < PROGRAM_OPERATIONS; i++)
+    {
+        Sound sound = shared[GetRandomNext(random)%SHARED_SOUNDS];
+        float value = (float)(GetRandomNext(random)%1000)/1000.0f;
+
+        switch (GetRandomNext(random)%15)
+        {
+            case 0: PlaySound(sound); break;
+            case 1: StopSound(sound); break;
+            case 2: PauseSound(sound); break;
+            case 3: ResumeSound(sound); break;
+            case 4: SetSoundVolume(sound, value); break;
+            case 5: SetSoundPitch(sound, 0.5f + value); break;
+            case 6: SetSoundPan(sound, value); break;
+            case 7: SetSoundVolumeScheduled(sound, value, GetAudioClockFrames() + GetRandomNext(random)%4096, PERIOD_FRAMES); break;
+            case 8: PlaySoundScheduled(sound, GetAudioClockFrames() + GetRandomNext(random)%4096); break;
+            case 9:
+            {
+                unsigned int instance = PlaySoundInstance(sound, GetRandomNext(random)%3);
+                if (instance != 0)
+                {
+                    SetSoundInstancePitch(instance, 0.5f + value);
+                    if (GetRandomNext(random)%2) StopSoundInstance(instance);
+                }
+            } break;
+            case 10:
+            {
+                // Sound is reported playing until its end could have been mixed
+                unsigned long long played = GetAudioClockFrames();
+                PlaySound(own);
+                if (!IsSoundPlaying(own) && (GetAudioClockFrames() < (played + TONE_FRAMES))) atomic_fetch_add(&stateErrors, 1);
+            } break;
+            case 11:
+            {
+                StopSound(own);
+                if (IsSoundPlaying(own)) atomic_fetch_add(&stateErrors, 1);
+            } break;
+            case 12:
+            {
+                PauseSound(own);
+                if (IsSoundPlaying(own)) atomic_fetch_add(&stateErrors, 1);
+                ResumeSound(own);
+            } break;
+            case 13:
+            {
+                // Alias buffer is tracked, played and untracked while mixer is rendering
+                Sound alias = LoadSoundAlias(sound);
+                PlaySound(alias);
+                UnloadSoundAlias(alias);
+            } break;
+            case 14: SetAudioBusVolume(AUDIO_BUS_SFX, 0.5f + value); break;
+            default: break;
+        }
+    }
+
+    UnloadSoundAlias(own);
+
+    return NULL;
+}
+
+// Per-thread random generator (xorshift)
+static unsigned int GetRandomNext(unsigned int *state)
+{
+    unsigned int x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
@@ -0,0 +1,164 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - offline render
+*
+*   A scene (scheduled sounds, ramps, pitched sound, sound instances, an audio stream and bus effects)
+*   is rendered in offline mode, then audio device is closed, initialized again and the scene
+*   is rendered again, no audio device is required, so it can be run on headless systems
+*
+*   Checks:
+*     - Both renders are bit-identical (hash of all rendered samples) and not silent
+*
+*   First render is exported to offline_render.wav
+*
+*   Program returns 0 if all checks passed
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>                         // Required for: calloc(), free()
+#include <math.h>                           // Required for: sinf(), fabsf()
+
+#define SAMPLE_RATE             48000       // Mixer sample rate
+#define PERIOD_FRAMES             480       // Frames rendered per mixer period (10 ms)
+#define RENDER_PERIODS            300       // Mixer periods rendered (3 seconds)
+
+#define STREAM_SAMPLE_RATE      22050       // Audio stream sample rate, resampled by the mixer
+#define STREAM_FRAMES             221       // Audio stream frames pushed per mixer period (10 ms)
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned long long RenderScene(float *frames);                   // Init audio device, render scene and close audio device, returns render hash
+static Sound LoadSoundTone(float frequency, float seconds);             // Load sound from a generated tone
+static unsigned long long HashSamples(const float *samples, int count); // Hash samples (FNV-1a)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Render scene twice, audio device initialized for every render
+    //--------------------------------------------------------------------------------------
+    float *frames = (float *)calloc(RENDER_PERIODS*PERIOD_FRAMES*2, sizeof(float));
+    float *framesAgain = (float *)calloc(RENDER_PERIODS*PERIOD_FRAMES*2, sizeof(float));
+
+    unsigned long long hash = RenderScene(frames);
+    unsigned long long hashAgain = RenderScene(framesAgain);
+    //--------------------------------------------------------------------------------------
+
+    // Check results and export first render
+    //--------------------------------------------------------------------------------------
+    float peak = 0.0f;
+    for (int i = 0; i < RENDER_PERIODS*PERIOD_FRAMES*2; i++) if (fabsf(frames[i]) > peak) peak = fabsf(frames[i]);
+
+    Wave wave = { .frameCount = RENDER_PERIODS*PERIOD_FRAMES, .sampleRate = SAMPLE_RATE, .sampleSize = 32, .channels = 2, .data = frames };
+    bool exported = ExportWave(wave, "offline_render.wav");
+
+    bool passed = (hash == hashAgain) && (peak > 0.1f) && exported;
+
+    TraceLog(LOG_INFO, "OFFLINE: %i frames rendered twice, peak level %.3f", RENDER_PERIODS*PERIOD_FRAMES, peak);
+    TraceLog(LOG_INFO, "OFFLINE: Render hash 0x%016llx, render after re-init hash 0x%016llx", hash, hashAgain);
+    TraceLog(passed? LOG_INFO : LOG_WARNING, "OFFLINE: %s", passed? "All checks passed" : "Checks failed");
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(frames);
+    free(framesAgain);
+    //--------------------------------------------------------------------------------------
+
+    return passed? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Init audio device, render scene and close audio device, returns render hash
+static unsigned long long RenderScene(float *frames)
+{
+    InitAudioDeviceEx((AudioDeviceConfig){ .sampleRate = SAMPLE_RATE, .periodFrames = PERIOD_FRAMES, .offline = true });
+
+    Sound low = LoadSoundTone(220.0f, 0.5f);
+    Sound high = LoadSoundTone(660.0f, 0.3f);
+
+    AudioStream stream = LoadAudioStream(STREAM_SAMPLE_RATE, 16, 1);
+    short samples[STREAM_FRAMES] = { 0 };
+
+    // Scene: scheduled sounds with ramps, a pitched sound, a reverb on sound effects bus
+    // and an audio stream on voice bus, started later
+    AddAudioBusEffect(AUDIO_BUS_SFX, AUDIO_EFFECT_REVERB);
+    SetAudioStreamBus(stream, AUDIO_BUS_VOICE);
+
+    PlaySoundScheduled(low, 1000);
+    SetSoundPanScheduled(low, 0.0f, 12000, 4800);
+    SetSoundPitch(high, 1.5f);
+    PlaySoundScheduled(high, 24000);
+    SetSoundVolumeScheduled(high, 0.2f, 30000, 2400);
+
+    for (int period = 0; period < RENDER_PERIODS; period++)
+    {
+        // Sound instances started every quarter second, stream fed from one second on
+        if ((period%25) == 0) SetSoundInstancePan(PlaySoundInstance(low, 0), (float)(period%100)/100.0f);
+
+        if (period == 100) PlayAudioStream(stream);
+
+        if (period >= 100)
+        {
+            for (int i = 0; i < STREAM_FRAMES; i++) samples[i] = (short)(8000.0f*sinf(2.0f*PI*330.0f*(float)(period*STREAM_FRAMES + i)/STREAM_SAMPLE_RATE));
+            PushAudioStreamFrames(stream, samples, STREAM_FRAMES);
+        }
+
+        RenderAudioFrames(frames + period*PERIOD_FRAMES*2, PERIOD_FRAMES);
+    }
+
+    UnloadAudioStream(stream);
+    UnloadSound(low);
+    UnloadSound(high);
+
+    CloseAudioDevice();
+
+    return HashSamples(frames, RENDER_PERIODS*PERIOD_FRAMES*2);
+}
+
+// Load sound from a generated tone, stereo float samples
+static Sound LoadSoundTone(float frequency, float seconds)
+{
+    int frameCount = (int)(seconds*SAMPLE_RATE);
+    float *samples = (float *)calloc(frameCount*2, sizeof(float));
+
+    for (int f = 0; f < frameCount; f++)
+    {
+        samples[f*2] = 0.4f*sinf(2.0f*PI*frequency*(float)f/SAMPLE_RATE);
+        samples[f*2 + 1] = samples[f*2];
+    }
+
+    Wave wave = { .frameCount = frameCount, .sampleRate = SAMPLE_RATE, .sampleSize = 32, .channels = 2, .data = samples };
+    Sound sound = LoadSoundFromWave(wave);
+    free(samples);
+
+    return sound;
+}
+
+// Hash samples (FNV-1a), all samples bytes are hashed, so any difference changes the hash
+static unsigned long long HashSamples(const float *samples, int count)
+{
+    const unsigned char *bytes = (const unsigned char *)samples;
+    unsigned long long hash = 14695981039346656037ULL;  // FNV-1a offset basis
+
+    for (int i = 0; i < count*(int)sizeof(float); i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;       // FNV-1a prime
+    }
+
+    return hash;
+}
@@ -0,0 +1,149 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - compressed sound
+*
+*   A QOA file is loaded with LoadSound() (decoded to memory) and with LoadSoundCompressed()
+*   (kept compressed, decoded on demand while playing), both are rendered in offline mode
+*   with the same playback sequence: start, seek to the middle of the file, restart while playing,
+*   play to the end and start again once finished, no audio device is required
+*
+*   Checks:
+*     - Both renders are byte-identical, QOA decoded on demand gives same samples as QOA fully decoded
+*     - Renders are not silent and compressed sound saves memory (see GetAudioStats())
+*
+*   Program returns 0 if all checks passed
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>                         // Required for: calloc(), free()
+#include <string.h>                         // Required for: memcmp()
+#include <math.h>                           // Required for: sinf()
+
+#define SAMPLE_RATE             48000       // Mixer sample rate, same as QOA file, so no resampling is required
+#define PERIOD_FRAMES             480       // Frames rendered per mixer period (10 ms)
+#define SOUND_SECONDS               4       // QOA file length, in seconds
+
+#define SEEK_POSITION          2.345f       // Seek position, in seconds, not aligned to QOA frames or slices
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static int RenderSequence(Sound sound, float *frames);  // Render playback sequence, returns frames rendered
+static int RenderPeriods(float *frames, int periods);   // Render mixer periods, returns frames rendered
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    InitAudioDeviceEx((AudioDeviceConfig){ .sampleRate = SAMPLE_RATE, .periodFrames = PERIOD_FRAMES, .offline = true });
+
+    // Generate QOA file: stereo sweep, a different tone on every channel
+    short *samples = (short *)calloc(SAMPLE_RATE*SOUND_SECONDS*2, sizeof(short));
+
+    for (int f = 0; f < SAMPLE_RATE*SOUND_SECONDS; f++)
+    {
+        float time = (float)f/SAMPLE_RATE;
+        samples[f*2] = (short)(12000.0f*sinf(2.0f*PI*(200.0f + 100.0f*time)*time));
+        samples[f*2 + 1] = (short)(12000.0f*sinf(2.0f*PI*(900.0f - 100.0f*time)*time));
+    }
+
+    Wave wave = { .frameCount = SAMPLE_RATE*SOUND_SECONDS, .sampleRate = SAMPLE_RATE, .sampleSize = 16, .channels = 2, .data = samples };
+    ExportWave(wave, "compressed.qoa");
+    free(samples);
+
+    Sound sound = LoadSound("compressed.qoa");                  // QOA fully decoded to memory
+    Sound compressed = LoadSoundCompressed("compressed.qoa");   // QOA kept compressed in memory
+
+    // Rendered frames buffer, sequence length is less than three times the sound length
+    float *soundFrames = (float *)calloc(SAMPLE_RATE*SOUND_SECONDS*3*2, sizeof(float));
+    float *compressedFrames = (float *)calloc(SAMPLE_RATE*SOUND_SECONDS*3*2, sizeof(float));
+    //--------------------------------------------------------------------------------------
+
+    // Render same sequence for both sounds, one at a time
+    //--------------------------------------------------------------------------------------
+    int frameCount = RenderSequence(sound, soundFrames);
+    RenderSequence(compressed, compressedFrames);
+
+    AudioStats stats = GetAudioStats();
+    //--------------------------------------------------------------------------------------
+
+    // Check results
+    //--------------------------------------------------------------------------------------
+    int audibleFrames = 0;
+    for (int f = 0; f < frameCount; f++) if ((soundFrames[f*2] != 0.0f) || (soundFrames[f*2 + 1] != 0.0f)) audibleFrames++;
+
+    bool identical = (memcmp(soundFrames, compressedFrames, frameCount*2*sizeof(float)) == 0);
+    bool passed = IsSoundValid(sound) && IsSoundValid(compressed) && identical && (audibleFrames > SAMPLE_RATE*SOUND_SECONDS) && (stats.compressedSaved > 0);
+
+    TraceLog(LOG_INFO, "COMPRESSED: %i frames rendered (%i audible), LoadSound() and LoadSoundCompressed() renders %s", frameCount, audibleFrames, identical? "identical" : "different");
+    TraceLog(LOG_INFO, "COMPRESSED: Sounds memory: %llu bytes, %u compressed sounds: %llu bytes, %llu bytes saved",
+        stats.soundMemory, stats.compressedCount, stats.compressedMemory, stats.compressedSaved);
+    TraceLog(LOG_INFO, "COMPRESSED: Frames decoded on demand: %llu, decode time: %.3f ms", stats.framesDecoded, stats.decodeTime*1000.0);
+    TraceLog(passed? LOG_INFO : LOG_WARNING, "COMPRESSED: %s", passed? "All checks passed" : "Checks failed");
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    free(soundFrames);
+    free(compressedFrames);
+
+    UnloadSound(sound);
+    UnloadSound(compressed);
+
+    CloseAudioDevice();     // Close audio device
+    //--------------------------------------------------------------------------------------
+
+    return passed? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Render playback sequence: start, seek to the middle of the file, restart while playing,
+// play to the end and start again once finished (loop start)
+static int RenderSequence(Sound sound, float *frames)
+{
+    int frameCount = 0;
+
+    PlaySound(sound);
+    frameCount += RenderPeriods(frames + frameCount*2, 50);
+
+    SeekSound(sound, SEEK_POSITION);
+    frameCount += RenderPeriods(frames + frameCount*2, 100);
+
+    PlaySound(sound);
+    frameCount += RenderPeriods(frames + frameCount*2, 30);
+
+    // Sound ends while rendering, rest is silence
+    frameCount += RenderPeriods(frames + frameCount*2, SOUND_SECONDS*100 + 50);
+
+    PlaySound(sound);
+    frameCount += RenderPeriods(frames + frameCount*2, 100);
+
+    StopSound(sound);
+    RenderPeriods(NULL, 1);     // Stop applied, so next sequence starts from silence
+
+    return frameCount;
+}
+
+// Render mixer periods, returns frames rendered (output discarded if no frames provided)
+static int RenderPeriods(float *frames, int periods)
+{
+    float period[PERIOD_FRAMES*2] = { 0 };
+
+    for (int i = 0; i < periods; i++) RenderAudioFrames((frames != NULL)? frames + i*PERIOD_FRAMES*2 : period, PERIOD_FRAMES);
+
+    return periods*PERIOD_FRAMES;
+}
@@ -0,0 +1,127 @@
+/*******************************************************************************************
+*
+*   raylib [audio] example - wave rhythm analysis
+*
+*   Click tracks are generated at a known tempo and first beat time, analyzed with LoadWaveRhythm()
+*   and analysis results are checked, no audio device is required, so it can be run on headless systems
+*
+*   Checks:
+*     - Tempo, beat grid offset and onsets count are detected within tolerance on a short click track
+*     - Same checks on a 4 minutes click track, analyzed in less than RHYTHM_MAX_TIME seconds
+*
+*   NOTE: Analysis time is processor time of all analysis threads, wall time is lower,
+*   time limit is raised on debug builds (NDEBUG not defined)
+*
+*   Program returns 0 if all checks passed
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdlib.h>                         // Required for: calloc(), free()
+#include <math.h>                           // Required for: sinf(), expf(), fabsf()
+#include <time.h>                           // Required for: clock()
+
+#define SAMPLE_RATE             44100       // Click track sample rate
+#define CLICK_TEMPO            128.0f       // Click track tempo (beats per minute)
+#define CLICK_OFFSET            0.37f       // Click track first beat time (seconds)
+
+#define TEMPO_TOLERANCE         0.25f       // Tempo maximum error (beats per minute)
+#define OFFSET_TOLERANCE       0.025f       // Beat grid offset maximum error (seconds), about two analysis hops
+#define ONSETS_TOLERANCE            2       // Onsets count maximum error
+#if defined(NDEBUG)
+    #define RHYTHM_MAX_TIME      0.5f       // Long click track maximum analysis time (seconds, processor time)
+#else
+    #define RHYTHM_MAX_TIME      2.0f       // Long click track maximum analysis time, debug build (not optimized)
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static Wave GenClickTrack(float seconds, float tempo, float offset);    // Generate click track wave, clicks over low noise
+static bool CheckRhythm(const char *name, float seconds);               // Generate and analyze a click track, check results
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    bool passed = CheckRhythm("Short", 30.0f) && CheckRhythm("Long", 240.0f);
+
+    TraceLog(passed? LOG_INFO : LOG_WARNING, "RHYTHM: %s", passed? "All checks passed" : "Checks failed");
+
+    return passed? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Generate and analyze a click track, check results, long tracks analysis time is also checked
+static bool CheckRhythm(const char *name, float seconds)
+{
+    Wave wave = GenClickTrack(seconds, CLICK_TEMPO, CLICK_OFFSET);
+
+    clock_t start = clock();
+    WaveRhythm rhythm = LoadWaveRhythm(wave);
+    double elapsed = (double)(clock() - start)/CLOCKS_PER_SEC;
+
+    int clicks = (int)((seconds - CLICK_OFFSET)/(60.0f/CLICK_TEMPO)) + 1;
+
+    bool passed = (fabsf(rhythm.tempo - CLICK_TEMPO) <= TEMPO_TOLERANCE) &&
+        (fabsf(rhythm.beatOffset - CLICK_OFFSET) <= OFFSET_TOLERANCE) &&
+        (abs(rhythm.onsetCount - clicks) <= ONSETS_TOLERANCE) &&
+        ((seconds < 60.0f) || (elapsed < RHYTHM_MAX_TIME));
+
+    TraceLog(LOG_INFO, "RHYTHM: %s click track (%.0f seconds): %.3f bpm (confidence %.2f), offset %.3f s, %i onsets (%i clicks), analyzed in %.3f s",
+        name, seconds, rhythm.tempo, rhythm.confidence, rhythm.beatOffset, rhythm.onsetCount, clicks, elapsed);
+
+    UnloadWaveRhythm(rhythm);
+    UnloadWave(wave);
+
+    return passed;
+}
+
+// Generate click track wave: 1 kHz clicks with a short decay, over low noise, mono float samples
+static Wave GenClickTrack(float seconds, float tempo, float offset)
+{
+    Wave wave = { 0 };
+    wave.frameCount = (unsigned int)(seconds*SAMPLE_RATE);
+    wave.sampleRate = SAMPLE_RATE;
+    wave.sampleSize = 32;
+    wave.channels = 1;
+
+    float *samples = (float *)calloc(wave.frameCount, sizeof(float));
+    unsigned int random = 0x2545f491;
+    float beatTime = 60.0f/tempo;
+
+    for (unsigned int i = 0; i < wave.frameCount; i++)
+    {
+        // Random generator (xorshift), noise at -60 dB
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        samples[i] = 0.001f*((float)(random >> 8)/8388608.0f - 1.0f);
+    }
+
+    for (int beat = 0; (offset + beat*beatTime) < seconds; beat++)
+    {
+        unsigned int first = (unsigned int)((offset + beat*beatTime)*SAMPLE_RATE);
+
+        for (unsigned int i = 0; (i < SAMPLE_RATE/50) && ((first + i) < wave.frameCount); i++)
+        {
+            float time = (float)i/SAMPLE_RATE;
+            samples[first + i] += 0.8f*expf(-time*300.0f)*sinf(2.0f*PI*1000.0f*time);
+        }
+    }
+
+    wave.data = samples;
+
+    return wave;
+}
@@ -96,7 +96,7 @@ int main(void)
             FilePathList droppedFiles = LoadDroppedFiles();
 
             // Supports loading .rgs style files (text or binary) and .png style palette images
-            if (IsFileExtension(droppedFiles.paths[0], ".txt;.rae"))
+            if (IsFileExtension(droppedFiles.paths[0], ".txt;.rae;.raeb"))
             {
                 UnloadAutomationEventList(aelist);
                 aelist = LoadAutomationEventList(droppedFiles.paths[0]);
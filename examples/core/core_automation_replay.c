@@ -0,0 +1,306 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - automation events replay
+*
+*   A session driven by generated inputs is recorded as automation events, then it is replayed
+*   twice with the simulated clock: replays run as fast as possible and they must be bit-identical
+*
+*   Events are also exported and loaded as text and binary files (.raeb), and the session is recorded
+*   again streaming events to a binary file, in chunks (see SetAutomationEventStream())
+*
+*   Checks (example closes itself once replays are finished):
+*     - Simulation state hash and timings (GetTime(), GetFrameTime()) of every frame are the same
+*       on recording and on both replays
+*     - Events loaded from text file and from binary file are the same as events recorded
+*     - Events streamed (more than AUTOMATION_EVENTS_CHUNK_SIZE) are the same as events recorded,
+*       list recorded to is empty once recording is stopped, replaying streamed events gives same state hash
+*     - Binary file truncated loads events up to last complete chunk, same as events recorded
+*
+*   Program returns 0 if all checks passed
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <string.h>                         // Required for: memset(), memcmp()
+#include <time.h>                           // Required for: clock()
+
+#define SESSION_FRAMES           3600       // Session length, one minute at 60 fps
+#define PLAYER_SPEED           200.0f       // Player speed, in pixels per second
+#define CHUNK_EVENTS             1024       // Events per binary file chunk streamed (AUTOMATION_EVENTS_CHUNK_SIZE)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Simulation state, hashed every frame
+typedef struct State {
+    Vector2 position;                       // Player position, moved with arrow keys
+    Vector2 click;                          // Last mouse click position
+    int clicks;                             // Mouse clicks count
+    int keys;                               // Keys pressed count
+    double time;                            // Frame time, GetTime()
+    float frameTime;                        // Frame delta, GetFrameTime()
+} State;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned long long RunSession(AutomationEventList *replay);  // Run session, generated inputs or replayed events, returns state hash
+static void InjectSessionInputs(int frame, unsigned int *random);   // Inject generated inputs for a frame
+static unsigned long long HashState(unsigned long long hash, const State *state);   // Hash state (FNV-1a)
+static bool CheckEventsEqual(const AutomationEvent *events, const AutomationEvent *expected, unsigned int count);  // Check events are the same, event by event
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - automation events replay");
+
+    SetTargetFPS(60);                   // Set our game to run at 60 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    // Record session, generated inputs
+    //--------------------------------------------------------------------------------------
+    AutomationEventList list = LoadAutomationEventList(NULL);
+    SetAutomationEventList(&list);
+
+    EnableSimulatedClock(0.0);          // Simulated clock restarted, same timings for recording and replays
+    SetAutomationEventBaseFrame(0);
+    StartAutomationEventRecording();
+
+    unsigned long long recordHash = RunSession(NULL);
+
+    StopAutomationEventRecording();
+    //--------------------------------------------------------------------------------------
+
+    // Replay session twice
+    //--------------------------------------------------------------------------------------
+    unsigned long long replayHash[2] = { 0 };
+    double replayTime[2] = { 0 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        clock_t start = clock();
+
+        EnableSimulatedClock(0.0);
+        replayHash[i] = RunSession(&list);
+
+        replayTime[i] = (double)(clock() - start)/CLOCKS_PER_SEC;
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Export events as text and binary files, loaded events must be the same
+    //--------------------------------------------------------------------------------------
+    ExportAutomationEventList(list, "automation.rae");
+    ExportAutomationEventList(list, "automation.raeb");
+
+    AutomationEventList textList = LoadAutomationEventList("automation.rae");
+    AutomationEventList binaryList = LoadAutomationEventList("automation.raeb");
+
+    bool filesEqual = (textList.count == list.count) && (binaryList.count == list.count) &&
+        CheckEventsEqual(textList.events, list.events, list.count) && CheckEventsEqual(binaryList.events, textList.events, list.count);
+    //--------------------------------------------------------------------------------------
+
+    // Record session again, events streamed to binary file in chunks
+    // NOTE: List recorded to is emptied on every chunk written, it is empty once recording is stopped
+    //--------------------------------------------------------------------------------------
+    AutomationEventList streamList = LoadAutomationEventList(NULL);
+    SetAutomationEventList(&streamList);
+    SetAutomationEventStream("automation_stream.raeb");
+
+    EnableSimulatedClock(0.0);
+    SetAutomationEventBaseFrame(0);
+    StartAutomationEventRecording();
+
+    unsigned long long streamHash = RunSession(NULL);
+
+    StopAutomationEventRecording();
+    unsigned int streamListCount = streamList.count;
+    SetAutomationEventStream(NULL);     // Close events stream
+
+    AutomationEventList streamedList = LoadAutomationEventList("automation_stream.raeb");
+
+    EnableSimulatedClock(0.0);
+    unsigned long long streamReplayHash = RunSession(&streamedList);
+
+    bool streamEqual = (list.count > CHUNK_EVENTS) && (streamListCount == 0) && (streamHash == recordHash) &&
+        (streamedList.count == list.count) && CheckEventsEqual(streamedList.events, list.events, list.count) && (streamReplayHash == recordHash);
+    //--------------------------------------------------------------------------------------
+
+    // Load binary file truncated, events must be loaded up to last complete chunk
+    //--------------------------------------------------------------------------------------
+    int dataSize = 0;
+    unsigned char *data = LoadFileData("automation_stream.raeb", &dataSize);
+    SaveFileData("automation_truncated.raeb", data, dataSize/2);
+    UnloadFileData(data);
+
+    AutomationEventList truncatedList = LoadAutomationEventList("automation_truncated.raeb");
+
+    bool truncatedEqual = (truncatedList.count > 0) && (truncatedList.count < list.count) &&
+        CheckEventsEqual(truncatedList.events, list.events, truncatedList.count);
+    //--------------------------------------------------------------------------------------
+
+    bool passed = (recordHash == replayHash[0]) && (replayHash[0] == replayHash[1]) && filesEqual && streamEqual && truncatedEqual;
+
+    TraceLog(LOG_INFO, "REPLAY: %i frames, %i events recorded", SESSION_FRAMES, list.count);
+    TraceLog(LOG_INFO, "REPLAY: State hash: record 0x%016llx, replay 0x%016llx, replay 0x%016llx", recordHash, replayHash[0], replayHash[1]);
+    TraceLog(LOG_INFO, "REPLAY: Replay time: %.3f and %.3f seconds (%.0f seconds of session)", replayTime[0], replayTime[1], (double)SESSION_FRAMES/60.0);
+    TraceLog(LOG_INFO, "REPLAY: Files: text %i events, binary %i events, %s", textList.count, binaryList.count, filesEqual? "same as recorded" : "different");
+    TraceLog(LOG_INFO, "REPLAY: Stream: %i events (%i left in list), replay hash 0x%016llx, %s", streamedList.count, streamListCount, streamReplayHash, streamEqual? "same as recorded" : "different");
+    TraceLog(LOG_INFO, "REPLAY: Truncated file: %i events loaded, %s", truncatedList.count, truncatedEqual? "same as recorded" : "different");
+    TraceLog(passed? LOG_INFO : LOG_WARNING, "REPLAY: %s", passed? "All checks passed" : "Checks failed");
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    UnloadAutomationEventList(list);
+    UnloadAutomationEventList(textList);
+    UnloadAutomationEventList(binaryList);
+    UnloadAutomationEventList(streamList);
+    UnloadAutomationEventList(streamedList);
+    UnloadAutomationEventList(truncatedList);
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return passed? 0 : 1;
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Run session, generated inputs (recording) or replayed events, returns state hash of all frames
+static unsigned long long RunSession(AutomationEventList *replay)
+{
+    State state = { 0 };
+    unsigned long long hash = 14695981039346656037ULL;  // FNV-1a offset basis
+    unsigned int random = 0x2545f491;
+    unsigned int event = 0;
+
+    memset(&state, 0, sizeof(State));   // Padding bytes are hashed
+    SetMousePosition(0, 0);
+
+    for (int frame = 0; (frame < SESSION_FRAMES) && !WindowShouldClose(); frame++)
+    {
+        // Inputs, generated or replayed
+        // NOTE: Multiple events could be played in a single frame
+        //----------------------------------------------------------------------------------
+        if (replay == NULL) InjectSessionInputs(frame, &random);
+        else
+        {
+            while ((event < replay->count) && (replay->events[event].frame == (unsigned int)frame))
+            {
+                PlayAutomationEvent(replay->events[event]);
+                event++;
+            }
+        }
+        //----------------------------------------------------------------------------------
+
+        // Update
+        //----------------------------------------------------------------------------------
+        state.time = GetTime();
+        state.frameTime = GetFrameTime();
+
+        if (IsKeyDown(KEY_RIGHT)) state.position.x += PLAYER_SPEED*state.frameTime;
+        if (IsKeyDown(KEY_LEFT)) state.position.x -= PLAYER_SPEED*state.frameTime;
+        if (IsKeyDown(KEY_DOWN)) state.position.y += PLAYER_SPEED*state.frameTime;
+        if (IsKeyDown(KEY_UP)) state.position.y -= PLAYER_SPEED*state.frameTime;
+
+        for (int key = KEY_RIGHT; key <= KEY_UP; key++) if (IsKeyPressed(key)) state.keys++;
+
+        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
+        {
+            state.click = GetMousePosition();
+            state.clicks++;
+        }
+
+        hash = HashState(hash, &state);
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawCircleV(state.position, 20, MAROON);
+            DrawCircleV(state.click, 5, DARKBLUE);
+
+            DrawText(TextFormat("%s: frame %i, time %.3f", (replay == NULL)? "RECORDING" : "REPLAYING", frame, state.time), 10, 10, 20, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    return hash;
+}
+
+// Inject generated inputs for a frame: arrow keys and mouse clicks, all released on last frame
+static void InjectSessionInputs(int frame, unsigned int *random)
+{
+    // Random generator (xorshift)
+    *random ^= *random << 13;
+    *random ^= *random >> 17;
+    *random ^= *random << 5;
+
+    bool last = (frame == (SESSION_FRAMES - 1));
+    InputEvent event = { 0 };
+
+    if (((*random%8) == 0) || last)
+    {
+        event.type = INPUT_EVENT_KEY;
+        event.code = KEY_RIGHT + (*random >> 8)%4;
+        event.pressed = last? false : !IsKeyDown(event.code);
+
+        if (last) for (int key = KEY_RIGHT; key <= KEY_UP; key++) { event.code = key; InjectInputEvent(event); }
+        else InjectInputEvent(event);
+    }
+
+    if (((*random%16) == 1) || last)
+    {
+        event.type = INPUT_EVENT_MOUSE_BUTTON;
+        event.code = MOUSE_BUTTON_LEFT;
+        event.pressed = last? false : !IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+        event.position = (Vector2){ (float)((*random >> 8)%800), (float)((*random >> 20)%450) };
+
+        InjectInputEvent(event);
+    }
+}
+
+// Hash state (FNV-1a), all state bytes are hashed, so any difference changes the hash
+static unsigned long long HashState(unsigned long long hash, const State *state)
+{
+    const unsigned char *bytes = (const unsigned char *)state;
+
+    for (int i = 0; i < (int)sizeof(State); i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;       // FNV-1a prime
+    }
+
+    return hash;
+}
+
+// Check events are the same, event by event, all fields
+static bool CheckEventsEqual(const AutomationEvent *events, const AutomationEvent *expected, unsigned int count)
+{
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if ((events[i].frame != expected[i].frame) || (events[i].type != expected[i].type) ||
+            (memcmp(events[i].params, expected[i].params, sizeof(events[i].params)) != 0)) return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************************
+*
+*   raylib [core] example - Gamepad polling thread
+*
+*   Gamepads are polled by a background thread at 1000 Hz while the program runs at 30 fps,
+*   button transitions are registered with their polling timestamp (see GetInputEvents())
+*
+*   The virtual gamepad (gamepad 0) is used, it presses a button on every beat at 120 bpm,
+*   no gamepad device is required, so it can be run headless (PLATFORM_NULL)
+*
+*   Checks (example closes itself after a few seconds):
+*     - Button presses are registered on every beat, timestamped less than 2 ms after the beat (median),
+*       sampled once per frame they would be registered up to a frame time (33 ms) after it
+*
+*   NOTE: Median is checked, a few presses can be late on a loaded system (thread wake up latency)
+*
+*   Program returns 0 if all checks passed
+*
+*   Example originally created with raylib 5.5
+*
+*   Example licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2024 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>                           // Required for: fmod()
+
+#define POLLING_RATE             1000       // Gamepad polling rate (Hz)
+#define TARGET_FPS                 30       // Program frame rate, lower than polling rate
+#define CHECK_SECONDS               5       // Program running time, in seconds
+#define BEAT_TIME                 0.5       // Virtual gamepad button press interval, in seconds
+#define MAX_PRESSES                64       // Maximum presses registered
+#define MAX_ERROR_MEDIAN        0.002       // Maximum press timestamp median error, in seconds
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    const int screenWidth = 800;
+    const int screenHeight = 450;
+
+    InitWindow(screenWidth, screenHeight, "raylib [core] example - gamepad polling thread");
+
+    DisableSimulatedClock();            // Gamepad polling thread requires the real clock (null platform)
+    EnableInputEvents();
+    EnableGamepadPolling(POLLING_RATE, GAMEPAD_POLLING_VIRTUAL);
+
+    SetTargetFPS(TARGET_FPS);           // Set our game to run at 30 frames-per-second
+    //--------------------------------------------------------------------------------------
+
+    InputEvent events[64] = { 0 };
+    double errors[MAX_PRESSES] = { 0 }; // Press timestamps error, time from beat to press (sorted)
+    double errorMax = 0.0;              // Maximum press timestamp error
+    double delayMax = 0.0;              // Maximum delay from press to frame processing it
+    int presses = 0;
+
+    // Main game loop
+    while (!WindowShouldClose() && (GetTime() < CHECK_SECONDS))    // Detect window close button or ESC key
+    {
+        // Update
+        //----------------------------------------------------------------------------------
+        int count = GetInputEvents(events, 64);
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((events[i].type != INPUT_EVENT_GAMEPAD_BUTTON) || (events[i].device != 0) ||
+                (events[i].code != GAMEPAD_BUTTON_RIGHT_FACE_DOWN) || !events[i].pressed) continue;
+
+            // Virtual gamepad presses the button on the beat, polled at 1 ms intervals
+            double time = (double)events[i].timestamp/1000000000.0;
+            double error = fmod(time, BEAT_TIME);
+            double delay = GetTime() - time;
+
+            if (error > errorMax) errorMax = error;
+            if (delay > delayMax) delayMax = delay;
+
+            if (presses < MAX_PRESSES)
+            {
+                // Insert error sorted
+                int k = presses;
+                for (; (k > 0) && (errors[k - 1] > error); k--) errors[k] = errors[k - 1];
+                errors[k] = error;
+
+                presses++;
+            }
+        }
+        //----------------------------------------------------------------------------------
+
+        // Draw
+        //----------------------------------------------------------------------------------
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText(TextFormat("Gamepad: %s", GetGamepadName(0)), 10, 10, 20, DARKGRAY);
+            DrawText(TextFormat("Polling at %i Hz, drawing at %i fps", POLLING_RATE, GetFPS()), 10, 40, 20, DARKGRAY);
+
+            DrawCircle(400, 240, 60, IsGamepadButtonDown(0, GAMEPAD_BUTTON_RIGHT_FACE_DOWN)? LIME : LIGHTGRAY);
+
+            DrawText(TextFormat("Presses: %i", presses), 10, 360, 20, DARKGRAY);
+            DrawText(TextFormat("Press timestamp error: %.3f ms max", errorMax*1000.0), 10, 390, 20, DARKGRAY);
+            DrawText(TextFormat("Press to frame delay: %.3f ms max", delayMax*1000.0), 10, 420, 20, DARKGRAY);
+
+        EndDrawing();
+        //----------------------------------------------------------------------------------
+    }
+
+    double errorMedian = errors[presses/2];
+    bool passed = (presses >= (int)(CHECK_SECONDS/BEAT_TIME) - 1) && (errorMedian < MAX_ERROR_MEDIAN);
+
+    TraceLog(LOG_INFO, "POLLING: %i presses, timestamp error: %.3f ms median, %.3f ms max, press to frame delay: %.3f ms max",
+        presses, errorMedian*1000.0, errorMax*1000.0, delayMax*1000.0);
+    TraceLog(passed? LOG_INFO : LOG_WARNING, "POLLING: %s", passed? "All checks passed" : "Checks failed");
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    DisableGamepadPolling();
+
+    CloseWindow();        // Close window and OpenGL context
+    //--------------------------------------------------------------------------------------
+
+    return passed? 0 : 1;
+}
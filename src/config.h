@@ -57,6 +57,7 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
+// NOTE: Only used by WaitTime() and FRAME_PACING_LEGACY, default frame pacer busy-waits a self-calibrated slack
 #define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE          1
@@ -66,6 +67,9 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support gamepad polling thread, gamepads polled at a fixed rate independent of frame rate, see EnableGamepadPolling()
+// NOTE: Requires POSIX threads, not available on Windows, Web, Android and Switch
+#define SUPPORT_GAMEPAD_POLLING_THREAD  1
 // Support custom frame control, only for advanced users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -110,10 +114,15 @@
 #define MAX_TOUCH_POINTS                8       // Maximum number of touch points supported
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
+#define MAX_INPUT_EVENT_QUEUE         256       // Maximum number of timestamped input events queued
+#define MAX_GAMEPAD_POLLING_SNAPSHOTS 256       // Maximum number of gamepad snapshots queued by polling thread
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
-#define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
+#define MAX_AUTOMATION_EVENTS       16384       // Initial capacity of automation events list, grows as required
+#define AUTOMATION_EVENTS_CHUNK_SIZE 1024       // Number of automation events per binary file chunk (streamed on recording)
+
+#define MAX_FRAME_TIMING_HISTORY     1024       // Maximum number of frame timings kept in history (frame stats window)
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -284,6 +293,12 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_VOICES                  64    // Maximum number of sound instances playing at once (voice pool)
+#define MAX_AUDIO_COMMANDS              1024    // Maximum pending mixer commands, must be a power of 2
+#define MAX_AUDIO_BUSES                    8    // Maximum number of audio buses (submixes), first ones are AudioBusType
+#define MAX_AUDIO_BUS_EFFECTS              4    // Maximum number of effects on a bus effects chain
+#define MUSIC_SEEK_INDEX_STEP           1152    // Music seek index step in frames (MP3 frame size), seeks decode up to one step
+#define AUDIO_ANALYSIS_THREADS             4    // Maximum number of threads used for wave analysis
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -568,6 +568,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds since InitTimer()
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     double time = 0.0;
     struct timespec ts = { 0 };
     clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -1219,9 +1221,9 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
 
             if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_DOWN)
             {
-                CORE.Input.Gamepad.currentButtonState[0][button] = 1;
+                RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, 0, button, true, 0);
             }
-            else CORE.Input.Gamepad.currentButtonState[0][button] = 0;  // Key up
+            else RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, 0, button, false, 0);  // Key up
 
             return 1; // Handled gamepad button
         }
@@ -1233,13 +1235,13 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
             // NOTE: Android key action is 0 for down and 1 for up
             if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_DOWN)
             {
-                CORE.Input.Keyboard.currentKeyState[key] = 1;   // Key down
+                RegisterInputEvent(INPUT_EVENT_KEY, 0, key, true, 0);   // Key down
 
                 CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
                 CORE.Input.Keyboard.keyPressedQueueCount++;
             }
             else if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_MULTIPLE) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
-            else CORE.Input.Keyboard.currentKeyState[key] = 0;  // Key up
+            else RegisterInputEvent(INPUT_EVENT_KEY, 0, key, false, 0);  // Key up
         }
 
         if (keycode == AKEYCODE_POWER)
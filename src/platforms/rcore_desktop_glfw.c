@@ -1044,6 +1044,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds since InitTimer()
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     double time = glfwGetTime();   // Elapsed time since glfwInit()
     return time;
 }
@@ -1189,6 +1191,9 @@ void PollInputEvents(void)
             GLFWgamepadstate state = { 0 };
             glfwGetGamepadState(i, &state); // This remapps all gamepads so they have their buttons mapped like an xbox controller
 
+            // NOTE: Gamepad state is polled, transitions are timestamped at poll time
+            unsigned long long timestamp = (unsigned long long)(GetTime()*1000000000.0);
+
             const unsigned char *buttons = state.buttons;
 
             for (int k = 0; (buttons != NULL) && (k < MAX_GAMEPAD_BUTTONS); k++)
@@ -1223,10 +1228,10 @@ void PollInputEvents(void)
                 {
                     if (buttons[k] == GLFW_PRESS)
                     {
-                        CORE.Input.Gamepad.currentButtonState[i][button] = 1;
+                        RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, button, true, timestamp);
                         CORE.Input.Gamepad.lastButtonPressed = button;
                     }
-                    else CORE.Input.Gamepad.currentButtonState[i][button] = 0;
+                    else RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, button, false, timestamp);
                 }
             }
 
@@ -1239,13 +1244,18 @@ void PollInputEvents(void)
             }
 
             // Register buttons for 2nd triggers (because GLFW doesn't count these as buttons but rather axis)
-            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_LEFT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f);
-            CORE.Input.Gamepad.currentButtonState[i][GAMEPAD_BUTTON_RIGHT_TRIGGER_2] = (char)(CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f);
+            RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, GAMEPAD_BUTTON_LEFT_TRIGGER_2, (CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_LEFT_TRIGGER] > 0.1f), timestamp);
+            RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, GAMEPAD_BUTTON_RIGHT_TRIGGER_2, (CORE.Input.Gamepad.axisState[i][GAMEPAD_AXIS_RIGHT_TRIGGER] > 0.1f), timestamp);
 
             CORE.Input.Gamepad.axisCount[i] = GLFW_GAMEPAD_AXIS_LAST + 1;
         }
     }
 
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // Register gamepads polled by gamepad polling thread
+    PollGamepadSnapshots();
+#endif
+
     CORE.Window.resizedLastFrame = false;
 
     if (CORE.Window.eventWaiting) glfwWaitEvents();     // Wait for in input events before continue (drawing is paused)
@@ -1791,8 +1801,9 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 
     // WARNING: GLFW could return GLFW_REPEAT, we need to consider it as 1
     // to work properly with our implementation (IsKeyDown/IsKeyUp checks)
-    if (action == GLFW_RELEASE) CORE.Input.Keyboard.currentKeyState[key] = 0;
-    else if(action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
+    // NOTE: GLFW does not provide OS event timestamps, events are timestamped on callback
+    if (action == GLFW_RELEASE) RegisterInputEvent(INPUT_EVENT_KEY, 0, key, false, 0);
+    else if(action == GLFW_PRESS) RegisterInputEvent(INPUT_EVENT_KEY, 0, key, true, 0);
     else if(action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
     // WARNING: Check if CAPS/NUM key modifiers are enabled and force down state for those keys
@@ -1835,7 +1846,7 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
 {
     // WARNING: GLFW could only return GLFW_PRESS (1) or GLFW_RELEASE (0) for now,
     // but future releases may add more actions (i.e. GLFW_REPEAT)
-    CORE.Input.Mouse.currentButtonState[button] = action;
+    RegisterInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, button, (action == GLFW_PRESS), 0);
     CORE.Input.Touch.currentTouchState[button] = action;
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
@@ -747,6 +747,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds since InitTimer()
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     double time = 0.0;
     unsigned long long int nanoSeconds = RGFW_getTimeNS();
     time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
@@ -1002,7 +1004,7 @@ void PollInputEvents(void)
                         CORE.Input.Keyboard.keyPressedQueueCount++;
                     }
 
-                    CORE.Input.Keyboard.currentKeyState[key] = 1;
+                    RegisterInputEvent(INPUT_EVENT_KEY, 0, key, true, 0);
                 }
 
                 // TODO: Put exitKey verification outside the switch?
@@ -1023,7 +1025,7 @@ void PollInputEvents(void)
             case RGFW_keyReleased:
             {
                 KeyboardKey key = ConvertScancodeToKey(event->keyCode);
-                if (key != KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != KEY_NULL) RegisterInputEvent(INPUT_EVENT_KEY, 0, key, false, 0);
             } break;
 
             // Check mouse events
@@ -1040,7 +1042,7 @@ void PollInputEvents(void)
                 else if (btn == RGFW_mouseRight) btn = 2;
                 else if (btn == RGFW_mouseMiddle) btn = 3;
 
-                CORE.Input.Mouse.currentButtonState[btn - 1] = 1;
+                RegisterInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, btn - 1, true, 0);
                 CORE.Input.Touch.currentTouchState[btn - 1] = 1;
 
                 touchAction = 1;
@@ -1059,7 +1061,7 @@ void PollInputEvents(void)
                 else if (btn == RGFW_mouseRight) btn = 2;
                 else if (btn == RGFW_mouseMiddle) btn = 3;
 
-                CORE.Input.Mouse.currentButtonState[btn - 1] = 0;
+                RegisterInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, btn - 1, false, 0);
                 CORE.Input.Touch.currentTouchState[btn - 1] = 0;
 
                 touchAction = 0;
@@ -1233,6 +1235,11 @@ void PollInputEvents(void)
         }
 #endif
     }
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // Register gamepads polled by gamepad polling thread
+    PollGamepadSnapshots();
+#endif
     //-----------------------------------------------------------------------------
 }
 
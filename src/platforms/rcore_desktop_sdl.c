@@ -422,6 +422,7 @@ int InitPlatform(void);                                      // Initialize platf
 void ClosePlatform(void);                                    // Close platform
 
 static KeyboardKey ConvertScancodeToKey(SDL_Scancode sdlScancode);  // Help convert SDL scancodes to raylib key
+static unsigned long long GetEventTimestampSDL(Uint64 timestamp);   // Get SDL event timestamp in nanoseconds (GetTime() base)
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
@@ -1207,6 +1208,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     unsigned int ms = SDL_GetTicks();    // Elapsed time in milliseconds since SDL_Init()
     double time = (double)ms/1000;
     return time;
@@ -1273,6 +1276,17 @@ const char *GetKeyName(int key)
     return SDL_GetKeyName(key);
 }
 
+// Get SDL event timestamp in nanoseconds (GetTime() base)
+// NOTE: SDL2 timestamps are milliseconds since SDL_Init(), SDL3 timestamps are already nanoseconds
+static unsigned long long GetEventTimestampSDL(Uint64 timestamp)
+{
+#if defined(PLATFORM_DESKTOP_SDL3)
+    return (unsigned long long)timestamp;
+#else
+    return (unsigned long long)timestamp*1000000ULL;
+#endif
+}
+
 static void UpdateTouchPointsSDL(SDL_TouchFingerEvent event)
 {
 #if defined(PLATFORM_DESKTOP_SDL3) // SDL3
@@ -1280,13 +1294,13 @@ static void UpdateTouchPointsSDL(SDL_TouchFingerEvent event)
     SDL_Finger **fingers = SDL_GetTouchFingers(event.touchID, &count);
     CORE.Input.Touch.pointCount = count;
 
-    for (int i = 0; i < CORE.Input.Touch.pointCount; i++)
+    for (int i = 0; (i < CORE.Input.Touch.pointCount) && (i < MAX_TOUCH_POINTS); i++)
     {
         SDL_Finger *finger = fingers[i];
         CORE.Input.Touch.pointId[i] = finger->id;
         CORE.Input.Touch.position[i].x = finger->x*CORE.Window.screen.width;
         CORE.Input.Touch.position[i].y = finger->y*CORE.Window.screen.height;
-        CORE.Input.Touch.currentTouchState[i] = 1;
+        RegisterInputEvent(INPUT_EVENT_TOUCH, i, CORE.Input.Touch.pointId[i], true, GetEventTimestampSDL(event.timestamp));
     }
 
     SDL_free(fingers);
@@ -1295,17 +1309,17 @@ static void UpdateTouchPointsSDL(SDL_TouchFingerEvent event)
 
     CORE.Input.Touch.pointCount = SDL_GetNumTouchFingers(event.touchId);
 
-    for (int i = 0; i < CORE.Input.Touch.pointCount; i++)
+    for (int i = 0; (i < CORE.Input.Touch.pointCount) && (i < MAX_TOUCH_POINTS); i++)
     {
         SDL_Finger *finger = SDL_GetTouchFinger(event.touchId, i);
         CORE.Input.Touch.pointId[i] = finger->id;
         CORE.Input.Touch.position[i].x = finger->x*CORE.Window.screen.width;
         CORE.Input.Touch.position[i].y = finger->y*CORE.Window.screen.height;
-        CORE.Input.Touch.currentTouchState[i] = 1;
+        RegisterInputEvent(INPUT_EVENT_TOUCH, i, CORE.Input.Touch.pointId[i], true, GetEventTimestampSDL(event.timestamp));
     }
 #endif
 
-    for (int i = CORE.Input.Touch.pointCount; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.currentTouchState[i] = 0;
+    for (int i = CORE.Input.Touch.pointCount; i < MAX_TOUCH_POINTS; i++) RegisterInputEvent(INPUT_EVENT_TOUCH, i, CORE.Input.Touch.pointId[i], false, GetEventTimestampSDL(event.timestamp));
 }
 
 // Register all input events
@@ -1491,7 +1505,7 @@ void PollInputEvents(void)
                         CORE.Input.Keyboard.keyPressedQueueCount++;
                     }
 
-                    CORE.Input.Keyboard.currentKeyState[key] = 1;
+                    RegisterInputEvent(INPUT_EVENT_KEY, 0, key, true, GetEventTimestampSDL(event.key.timestamp));
                 }
 
                 if (event.key.repeat) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
@@ -1511,7 +1525,7 @@ void PollInputEvents(void)
             #else
                 KeyboardKey key = ConvertScancodeToKey(event.key.keysym.scancode);
             #endif
-                if (key != KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != KEY_NULL) RegisterInputEvent(INPUT_EVENT_KEY, 0, key, false, GetEventTimestampSDL(event.key.timestamp));
             } break;
 
             case SDL_TEXTINPUT:
@@ -1538,7 +1552,7 @@ void PollInputEvents(void)
                 if (btn == 2) btn = 1;
                 else if (btn == 1) btn = 2;
 
-                CORE.Input.Mouse.currentButtonState[btn] = 1;
+                RegisterInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, btn, true, GetEventTimestampSDL(event.button.timestamp));
                 CORE.Input.Touch.currentTouchState[btn] = 1;
 
                 touchAction = 1;
@@ -1551,7 +1565,7 @@ void PollInputEvents(void)
                 if (btn == 2) btn = 1;
                 else if (btn == 1) btn = 2;
 
-                CORE.Input.Mouse.currentButtonState[btn] = 0;
+                RegisterInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, btn, false, GetEventTimestampSDL(event.button.timestamp));
                 CORE.Input.Touch.currentTouchState[btn] = 0;
 
                 touchAction = 0;
@@ -1664,7 +1678,7 @@ void PollInputEvents(void)
 
                 if (button >= 0)
                 {
-                    CORE.Input.Gamepad.currentButtonState[event.jbutton.which][button] = 1;
+                    RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, event.jbutton.which, button, true, GetEventTimestampSDL(event.jbutton.timestamp));
                     CORE.Input.Gamepad.lastButtonPressed = button;
                 }
             } break;
@@ -1698,7 +1712,7 @@ void PollInputEvents(void)
 
                 if (button >= 0)
                 {
-                    CORE.Input.Gamepad.currentButtonState[event.jbutton.which][button] = 0;
+                    RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, event.jbutton.which, button, false, GetEventTimestampSDL(event.jbutton.timestamp));
                     if (CORE.Input.Gamepad.lastButtonPressed == button) CORE.Input.Gamepad.lastButtonPressed = 0;
                 }
             } break;
@@ -1728,7 +1742,7 @@ void PollInputEvents(void)
                     {
                         int button = (axis == GAMEPAD_AXIS_LEFT_TRIGGER)? GAMEPAD_BUTTON_LEFT_TRIGGER_2 : GAMEPAD_BUTTON_RIGHT_TRIGGER_2;
                         int pressed = (value > 0.1f);
-                        CORE.Input.Gamepad.currentButtonState[event.jaxis.which][button] = pressed;
+                        RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, event.jaxis.which, button, pressed, GetEventTimestampSDL(event.jaxis.timestamp));
                         if (pressed) CORE.Input.Gamepad.lastButtonPressed = button;
                         else if (CORE.Input.Gamepad.lastButtonPressed == button) CORE.Input.Gamepad.lastButtonPressed = 0;
                     }
@@ -1767,6 +1781,11 @@ void PollInputEvents(void)
         }
 #endif
     }
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // Register gamepads polled by gamepad polling thread
+    PollGamepadSnapshots();
+#endif
     //-----------------------------------------------------------------------------
 }
 
@@ -127,6 +127,11 @@ typedef struct {
     int gamepadAbsAxisRange[MAX_GAMEPADS][MAX_GAMEPAD_AXIS][2]; // [0] = min, [1] = range value of the axis
     int gamepadAbsAxisMap[MAX_GAMEPADS][ABS_CNT]; // Maps the axes gamepads from the evdev api to a sequential one
     int gamepadCount;                   // The number of gamepads registered
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // NOTE: Only accessed by gamepad polling thread, see PollGamepadDevice()
+    char gamepadPollButtons[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS]; // Gamepad buttons state read by polling thread
+    float gamepadPollAxis[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];      // Gamepad axis state read by polling thread
+#endif
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -231,6 +236,11 @@ static void ConfigureEvdevDevice(char *device); // Identifies a input device and
 static void PollKeyboardEvents(void);           // Process evdev keyboard events
 static void PollGamepadEvents(void);            // Process evdev gamepad events
 static void PollMouseEvents(void);              // Process evdev mouse events
+static unsigned long long GetEvdevEventTime(const struct input_event *event);  // Get evdev event timestamp in nanoseconds (GetTime() base)
+static void SetEvdevMouseButton(int button, int value, unsigned long long timestamp);  // Set evdev mouse button state, transitions are queued
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+static bool PollGamepadDevice(int gamepad, GamepadSnapshot *snapshot);  // Gamepad polling source: evdev gamepads, read by polling thread
+#endif
 
 static int FindMatchingConnectorMode(const drmModeConnector *connector, const drmModeModeInfo *mode);                               // Search matching DRM mode in connector's mode list
 static int FindExactConnectorMode(const drmModeConnector *connector, uint width, uint height, uint fps, bool allowInterlaced);      // Search exactly matching DRM connector mode in connector's list
@@ -588,6 +598,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds since InitTimer()
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     double time = 0.0;
     struct timespec ts = { 0 };
     clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -699,6 +711,11 @@ void PollInputEvents(void)
     // Register gamepads buttons events
     PollGamepadEvents();
 
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // Register gamepads polled by gamepad polling thread
+    PollGamepadSnapshots();
+#endif
+
     // Register previous touch states
     for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
 
@@ -1070,6 +1087,10 @@ int InitPlatform(void)
     //----------------------------------------------------------------------------
     InitEvdevInput();   // Evdev inputs initialization
 
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    CORE.Input.Gamepad.Polling.deviceSource = PollGamepadDevice;    // Evdev gamepads can be read by gamepad polling thread
+#endif
+
 #if defined(SUPPORT_SSH_KEYBOARD_RPI)
     InitKeyboard();     // Keyboard init (stdin)
 #endif
@@ -1404,6 +1425,11 @@ static void ConfigureEvdevDevice(char *device)
         return;
     }
 
+    // Request event timestamps on the same clock used by GetTime(), kernel default is CLOCK_REALTIME
+    // NOTE: Older kernels could not support it, GetEvdevEventTime() falls back to current time
+    int clockId = CLOCK_MONOTONIC;
+    ioctl(fd, EVIOCSCLOCKID, &clockId);
+
     // At this point we have a connection to the device, but we don't yet know what the device is.
     // It could be many things, even as simple as a power button...
     //-------------------------------------------------------------------------------------------------------
@@ -1612,7 +1638,7 @@ static void PollKeyboardEvents(void)
                 // WARNING: https://www.kernel.org/doc/Documentation/input/input.txt
                 // Event interface: 'value' is the value the event carries. Either a relative change for EV_REL,
                 // absolute new value for EV_ABS (joysticks ...), or 0 for EV_KEY for release, 1 for keypress and 2 for autorepeat
-                CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1);
+                RegisterInputEvent(INPUT_EVENT_KEY, 0, keycode, (event.value >= 1), GetEvdevEventTime(&event));
                 CORE.Input.Keyboard.keyRepeatInFrame[keycode] = (event.value == 2);
 
                 // If the key is pressed add it to the queues
@@ -1641,6 +1667,11 @@ static void PollKeyboardEvents(void)
 // Poll gamepad input events
 static void PollGamepadEvents(void)
 {
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // Gamepad events are read by gamepad polling thread, see PollGamepadDevice()
+    if (CORE.Input.Gamepad.Polling.active && (CORE.Input.Gamepad.Polling.source == PollGamepadDevice)) return;
+#endif
+
     // Read gamepad event
     struct input_event event = { 0 };
 
@@ -1664,7 +1695,7 @@ static void PollGamepadEvents(void)
                     if ((keycodeRaylib != 0) && (keycodeRaylib < MAX_GAMEPAD_BUTTONS))
                     {
                         // 1 - button pressed, 0 - button released
-                        CORE.Input.Gamepad.currentButtonState[i][keycodeRaylib] = event.value;
+                        RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, keycodeRaylib, (event.value != 0), GetEvdevEventTime(&event));
 
                         CORE.Input.Gamepad.lastButtonPressed = (event.value == 1)? keycodeRaylib : GAMEPAD_BUTTON_UNKNOWN;
                     }
@@ -1692,6 +1723,83 @@ static void PollGamepadEvents(void)
     }
 }
 
+// Get evdev event timestamp in nanoseconds (GetTime() base)
+// NOTE: Timestamp is set by the kernel on interrupt, it requires CLOCK_MONOTONIC set with EVIOCSCLOCKID
+static unsigned long long GetEvdevEventTime(const struct input_event *event)
+{
+#if defined(input_event_sec)
+    unsigned long long nanoSeconds = (unsigned long long)event->input_event_sec*1000000000LLU + (unsigned long long)event->input_event_usec*1000LLU;
+#else
+    unsigned long long nanoSeconds = (unsigned long long)event->time.tv_sec*1000000000LLU + (unsigned long long)event->time.tv_usec*1000LLU;
+#endif
+    unsigned long long now = (unsigned long long)(GetTime()*1000000000.0);
+
+    // Check timestamp is on GetTime() clock, in case EVIOCSCLOCKID failed use current time
+    if ((nanoSeconds < CORE.Time.base) || ((nanoSeconds - CORE.Time.base) > now)) return now;
+
+    return nanoSeconds - CORE.Time.base;
+}
+
+// Set evdev mouse button state, transitions are queued
+// NOTE: Mouse state is registered on next PollInputEvents(), see currentButtonStateEvdev
+static void SetEvdevMouseButton(int button, int value, unsigned long long timestamp)
+{
+    if (platform.currentButtonStateEvdev[button] != (char)(value != 0)) QueueInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, button, (value != 0), timestamp);
+
+    platform.currentButtonStateEvdev[button] = (char)(value != 0);
+}
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+// Gamepad polling source: evdev gamepads, read by polling thread
+// NOTE: Snapshot timestamp is the kernel timestamp of the first event changing a button state,
+// or the last axis event if no button changed, so axis events do not delay button transitions
+static bool PollGamepadDevice(int gamepad, GamepadSnapshot *snapshot)
+{
+    if (gamepad >= platform.gamepadCount) return false;
+
+    struct input_event event = { 0 };
+    unsigned long long buttonTime = 0;
+    unsigned long long axisTime = 0;
+
+    while (read(platform.gamepadStreamFd[gamepad], &event, sizeof(event)) == (int)sizeof(event))
+    {
+        if ((event.type == EV_KEY) && (event.code < KEYMAP_SIZE))
+        {
+            short keycodeRaylib = linuxToRaylibMap[event.code];
+
+            if ((keycodeRaylib != 0) && (keycodeRaylib < MAX_GAMEPAD_BUTTONS))
+            {
+                if ((buttonTime == 0) && (platform.gamepadPollButtons[gamepad][keycodeRaylib] != (char)(event.value != 0))) buttonTime = GetEvdevEventTime(&event);
+
+                platform.gamepadPollButtons[gamepad][keycodeRaylib] = (event.value != 0);
+            }
+        }
+        else if ((event.type == EV_ABS) && (event.code < ABS_CNT))
+        {
+            int axisRaylib = platform.gamepadAbsAxisMap[gamepad][event.code];
+
+            if (axisRaylib < MAX_GAMEPAD_AXIS)
+            {
+                int min = platform.gamepadAbsAxisRange[gamepad][axisRaylib][0];
+                int range = platform.gamepadAbsAxisRange[gamepad][axisRaylib][1];
+
+                // NOTE: Scaling of event.value to get values between -1..1
+                if (range != 0) platform.gamepadPollAxis[gamepad][axisRaylib] = (2*(float)(event.value - min)/range) - 1;
+                axisTime = GetEvdevEventTime(&event);
+            }
+        }
+    }
+
+    snapshot->timestamp = (buttonTime != 0)? buttonTime : axisTime;
+
+    memcpy(snapshot->buttons, platform.gamepadPollButtons[gamepad], sizeof(snapshot->buttons));
+    memcpy(snapshot->axis, platform.gamepadPollAxis[gamepad], sizeof(snapshot->axis));
+    snapshot->axisCount = CORE.Input.Gamepad.axisCount[gamepad];
+
+    return true;
+}
+#endif
+
 // Poll mouse input events
 static void PollMouseEvents(void)
 {
@@ -1777,6 +1885,9 @@ static void PollMouseEvents(void)
                     CORE.Input.Touch.position[platform.touchSlot].x = -1;
                     CORE.Input.Touch.position[platform.touchSlot].y = -1;
                 }
+
+                // NOTE: Touch state is mapped to mouse buttons, multitouch transitions are only queued
+                if (platform.touchSlot < MAX_TOUCH_POINTS) QueueInputEvent(INPUT_EVENT_TOUCH, platform.touchSlot, platform.touchSlot, (event.value >= 0), GetEvdevEventTime(&event));
             }
 
             // Touchscreen tap
@@ -1786,13 +1897,13 @@ static void PollMouseEvents(void)
 
                 if (!event.value && previousMouseLeftButtonState)
                 {
-                    platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 0;
+                    SetEvdevMouseButton(MOUSE_BUTTON_LEFT, 0, GetEvdevEventTime(&event));
                     touchAction = 0;    // TOUCH_ACTION_UP
                 }
 
                 if (event.value && !previousMouseLeftButtonState)
                 {
-                    platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = 1;
+                    SetEvdevMouseButton(MOUSE_BUTTON_LEFT, 1, GetEvdevEventTime(&event));
                     touchAction = 1;    // TOUCH_ACTION_DOWN
                 }
             }
@@ -1805,18 +1916,18 @@ static void PollMouseEvents(void)
             // Mouse button parsing
             if ((event.code == BTN_TOUCH) || (event.code == BTN_LEFT))
             {
-                platform.currentButtonStateEvdev[MOUSE_BUTTON_LEFT] = event.value;
+                SetEvdevMouseButton(MOUSE_BUTTON_LEFT, event.value, GetEvdevEventTime(&event));
 
                 if (event.value > 0) touchAction = 1;   // TOUCH_ACTION_DOWN
                 else touchAction = 0;       // TOUCH_ACTION_UP
             }
 
-            if (event.code == BTN_RIGHT) platform.currentButtonStateEvdev[MOUSE_BUTTON_RIGHT] = event.value;
-            if (event.code == BTN_MIDDLE) platform.currentButtonStateEvdev[MOUSE_BUTTON_MIDDLE] = event.value;
-            if (event.code == BTN_SIDE) platform.currentButtonStateEvdev[MOUSE_BUTTON_SIDE] = event.value;
-            if (event.code == BTN_EXTRA) platform.currentButtonStateEvdev[MOUSE_BUTTON_EXTRA] = event.value;
-            if (event.code == BTN_FORWARD) platform.currentButtonStateEvdev[MOUSE_BUTTON_FORWARD] = event.value;
-            if (event.code == BTN_BACK) platform.currentButtonStateEvdev[MOUSE_BUTTON_BACK] = event.value;
+            if (event.code == BTN_RIGHT) SetEvdevMouseButton(MOUSE_BUTTON_RIGHT, event.value, GetEvdevEventTime(&event));
+            if (event.code == BTN_MIDDLE) SetEvdevMouseButton(MOUSE_BUTTON_MIDDLE, event.value, GetEvdevEventTime(&event));
+            if (event.code == BTN_SIDE) SetEvdevMouseButton(MOUSE_BUTTON_SIDE, event.value, GetEvdevEventTime(&event));
+            if (event.code == BTN_EXTRA) SetEvdevMouseButton(MOUSE_BUTTON_EXTRA, event.value, GetEvdevEventTime(&event));
+            if (event.code == BTN_FORWARD) SetEvdevMouseButton(MOUSE_BUTTON_FORWARD, event.value, GetEvdevEventTime(&event));
+            if (event.code == BTN_BACK) SetEvdevMouseButton(MOUSE_BUTTON_BACK, event.value, GetEvdevEventTime(&event));
         }
 
         // Screen confinement
@@ -0,0 +1,767 @@
+/**********************************************************************************************
+*
+*   rcore_null - Functions to manage window, graphics device and inputs without display
+*
+*   PLATFORM: NULL
+*       - Headless: CI, benchmarking and servers, no display or GPU required
+*
+*   LIMITATIONS:
+*       - No rasterization, OpenGL is provided by a null driver and drawing is discarded,
+*         CPU framebuffer only registers clear color (ClearBackground()), read by LoadImageFromScreen()
+*       - OpenGL 1.1 and OpenGL ES 3.0 not supported, an OpenGL procedures loader is required
+*       - Null driver procedures not returning values share a generic no-op procedure,
+*         calling convention must allow extra arguments (it is the case for all supported targets
+*         except Windows 32-bit, where OpenGL uses __stdcall)
+*       - Real clock (DisableSimulatedClock()) and gamepad polling thread only available on POSIX targets
+*
+*   ADDITIONAL NOTES:
+*       - TRACELOG() function is located in raylib [utils] module
+*       - Simulated clock enabled by default (see EnableSimulatedClock()): time advances by a fixed step
+*         on every frame, waits are skipped, application runs unthrottled and deterministic
+*       - Virtual gamepad for headless testing: EnableGamepadPolling() with GAMEPAD_POLLING_VIRTUAL,
+*         it requires the real clock
+*       - Synthetic inputs: InjectInputEvent(), SetMousePosition()
+*
+*   CONFIGURATION:
+*       #define NULL_DISPLAY_WIDTH, NULL_DISPLAY_HEIGHT
+*           Virtual display size, used if no screen size is requested, default 800x450
+*
+*   DEPENDENCIES:
+*       - none
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2013-2024 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef NULL_DISPLAY_WIDTH
+    #define NULL_DISPLAY_WIDTH            800       // Virtual display width, used if no screen size is requested
+#endif
+#ifndef NULL_DISPLAY_HEIGHT
+    #define NULL_DISPLAY_HEIGHT           450       // Virtual display height, used if no screen size is requested
+#endif
+
+// OpenGL version reported by null driver, it must match the loader in use
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    #define NULL_GL_VERSION         "OpenGL ES 2.0 raylib null driver"
+#elif defined(GRAPHICS_API_OPENGL_43)
+    #define NULL_GL_VERSION         "4.3.0 raylib null driver"
+#elif defined(GRAPHICS_API_OPENGL_21)
+    #define NULL_GL_VERSION         "2.1.0 raylib null driver"
+#else
+    #define NULL_GL_VERSION         "3.3.0 raylib null driver"
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    // Display data
+    unsigned char *framebuffer;         // CPU framebuffer (RGBA, 8 bit per channel)
+    int framebufferWidth;               // CPU framebuffer width
+    int framebufferHeight;              // CPU framebuffer height
+    unsigned char clearColor[4];        // Clear color, set by glClearColor()
+    unsigned int boundFramebuffer;      // Framebuffer bound, CPU framebuffer is 0
+    unsigned int lastObjectId;          // Last OpenGL object id generated by null driver
+
+    char *clipboardText;                // Clipboard text copy
+} PlatformData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern CoreData CORE;                   // Global CORE state context
+
+static PlatformData platform = { 0 };   // Platform specific data
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
+void ClosePlatform(void);        // Close platform
+
+static void ResizeFramebufferNull(int width, int height);   // Resize CPU framebuffer
+#if !defined(GRAPHICS_API_OPENGL_11) && !defined(GRAPHICS_API_OPENGL_ES3)
+static GLADapiproc GetProcAddressNull(const char *name);    // Get null driver OpenGL procedure address
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// NOTE: Functions declaration is provided by raylib.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Check if application should close
+bool WindowShouldClose(void)
+{
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+}
+
+// Toggle fullscreen mode
+void ToggleFullscreen(void)
+{
+    CORE.Window.fullscreen = !CORE.Window.fullscreen;
+    FLAG_TOGGLE(CORE.Window.flags, FLAG_FULLSCREEN_MODE);
+}
+
+// Toggle borderless windowed mode
+void ToggleBorderlessWindowed(void)
+{
+    FLAG_TOGGLE(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE);
+}
+
+// Set window state: maximized, if resizable
+void MaximizeWindow(void)
+{
+    FLAG_CLEAR(CORE.Window.flags, FLAG_WINDOW_MINIMIZED);
+    FLAG_SET(CORE.Window.flags, FLAG_WINDOW_MAXIMIZED);
+}
+
+// Set window state: minimized
+void MinimizeWindow(void)
+{
+    FLAG_CLEAR(CORE.Window.flags, FLAG_WINDOW_MAXIMIZED);
+    FLAG_SET(CORE.Window.flags, FLAG_WINDOW_MINIMIZED);
+}
+
+// Set window state: not minimized/maximized
+void RestoreWindow(void)
+{
+    FLAG_CLEAR(CORE.Window.flags, FLAG_WINDOW_MINIMIZED | FLAG_WINDOW_MAXIMIZED);
+}
+
+// Set window configuration state using flags
+// NOTE: There is no window, flags are only registered
+void SetWindowState(unsigned int flags)
+{
+    FLAG_SET(CORE.Window.flags, flags);
+    if (FLAG_CHECK(flags, FLAG_FULLSCREEN_MODE)) CORE.Window.fullscreen = true;
+}
+
+// Clear window configuration state flags
+void ClearWindowState(unsigned int flags)
+{
+    FLAG_CLEAR(CORE.Window.flags, flags);
+    if (FLAG_CHECK(flags, FLAG_FULLSCREEN_MODE)) CORE.Window.fullscreen = false;
+}
+
+// Set icon for window
+void SetWindowIcon(Image image)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcon() not available on target platform");
+}
+
+// Set icon for window
+void SetWindowIcons(Image *images, int count)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcons() not available on target platform");
+}
+
+// Set title for window
+void SetWindowTitle(const char *title)
+{
+    CORE.Window.title = title;
+}
+
+// Set window position on screen (windowed mode)
+void SetWindowPosition(int x, int y)
+{
+    CORE.Window.position.x = x;
+    CORE.Window.position.y = y;
+}
+
+// Set monitor for the current window
+void SetWindowMonitor(int monitor)
+{
+    if (monitor != 0) TRACELOG(LOG_WARNING, "SetWindowMonitor() only monitor 0 available on target platform");
+}
+
+// Set window minimum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+// Set window maximum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Set window dimensions
+void SetWindowSize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return;
+
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.render.width = width;
+    CORE.Window.render.height = height;
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+
+    ResizeFramebufferNull(width, height);
+    SetupViewport(width, height);
+
+    CORE.Window.resizedLastFrame = true;
+}
+
+// Set window opacity, value opacity is between 0.0 and 1.0
+void SetWindowOpacity(float opacity)
+{
+    TRACELOG(LOG_WARNING, "SetWindowOpacity() not available on target platform");
+}
+
+// Set window focused
+void SetWindowFocused(void)
+{
+    FLAG_CLEAR(CORE.Window.flags, FLAG_WINDOW_UNFOCUSED);
+}
+
+// Get native window handle
+// NOTE: There is no window, CPU framebuffer is returned (RGBA, 8 bit per channel, render size)
+void *GetWindowHandle(void)
+{
+    return platform.framebuffer;
+}
+
+// Get number of monitors
+int GetMonitorCount(void)
+{
+    return 1;
+}
+
+// Get number of monitors
+int GetCurrentMonitor(void)
+{
+    return 0;
+}
+
+// Get selected monitor position
+Vector2 GetMonitorPosition(int monitor)
+{
+    return (Vector2){ 0, 0 };
+}
+
+// Get selected monitor width (currently used by monitor)
+int GetMonitorWidth(int monitor)
+{
+    return CORE.Window.display.width;
+}
+
+// Get selected monitor height (currently used by monitor)
+int GetMonitorHeight(int monitor)
+{
+    return CORE.Window.display.height;
+}
+
+// Get selected monitor physical width in millimetres
+int GetMonitorPhysicalWidth(int monitor)
+{
+    TRACELOG(LOG_WARNING, "GetMonitorPhysicalWidth() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor physical height in millimetres
+int GetMonitorPhysicalHeight(int monitor)
+{
+    TRACELOG(LOG_WARNING, "GetMonitorPhysicalHeight() not implemented on target platform");
+    return 0;
+}
+
+// Get selected monitor refresh rate
+// NOTE: Virtual display refresh rate matches the simulated clock step
+int GetMonitorRefreshRate(int monitor)
+{
+    return (int)(1.0/GetSimulatedTimeStep() + 0.5);
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *GetMonitorName(int monitor)
+{
+    return "NULL";
+}
+
+// Get window position XY on monitor
+Vector2 GetWindowPosition(void)
+{
+    return (Vector2){ (float)CORE.Window.position.x, (float)CORE.Window.position.y };
+}
+
+// Get window scale DPI factor for current monitor
+Vector2 GetWindowScaleDPI(void)
+{
+    return (Vector2){ 1.0f, 1.0f };
+}
+
+// Set clipboard text content
+// NOTE: Clipboard is not shared with other applications
+void SetClipboardText(const char *text)
+{
+    RL_FREE(platform.clipboardText);
+    platform.clipboardText = NULL;
+
+    if (text != NULL)
+    {
+        int length = (int)strlen(text);
+        platform.clipboardText = (char *)RL_MALLOC(length + 1);
+        memcpy(platform.clipboardText, text, length + 1);
+    }
+}
+
+// Get clipboard text content
+const char *GetClipboardText(void)
+{
+    return platform.clipboardText;
+}
+
+// Get clipboard image
+Image GetClipboardImage(void)
+{
+    Image image = { 0 };
+
+    TRACELOG(LOG_WARNING, "GetClipboardImage() not implemented on target platform");
+
+    return image;
+}
+
+// Show mouse cursor
+void ShowCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Hides mouse cursor
+void HideCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Enables cursor (unlock cursor)
+void EnableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Disables cursor (lock cursor)
+void DisableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Swap back buffer with front buffer (screen drawing)
+// NOTE: There is no screen, CPU framebuffer is kept as is
+void SwapScreenBuffer(void)
+{
+    // Nothing to do
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get elapsed time measure in seconds since InitTimer()
+// NOTE: Simulated clock by default, time only advances with frames and waits
+double GetTime(void)
+{
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
+    double time = 0.0;
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
+#endif
+
+    return time;
+}
+
+// Open URL with default system browser (if available)
+void OpenURL(const char *url)
+{
+    TRACELOG(LOG_WARNING, "OpenURL() not available on target platform");
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+
+// Set internal gamepad mappings
+int SetGamepadMappings(const char *mappings)
+{
+    TRACELOG(LOG_WARNING, "SetGamepadMappings() not implemented on target platform");
+    return 0;
+}
+
+// Set gamepad vibration
+void SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration)
+{
+    TRACELOG(LOG_WARNING, "SetGamepadVibration() not available on target platform");
+}
+
+// Set mouse position XY
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+    CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+}
+
+// Set mouse cursor
+void SetMouseCursor(int cursor)
+{
+    CORE.Input.Mouse.cursor = cursor;
+}
+
+// Get physical key name.
+const char *GetKeyName(int key)
+{
+    TRACELOG(LOG_WARNING, "GetKeyName() not implemented on target platform");
+    return "";
+}
+
+// Register all input events
+// NOTE: There are no input devices, inputs are injected with InjectInputEvent()
+void PollInputEvents(void)
+{
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0; // GAMEPAD_BUTTON_UNKNOWN
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    // Register previous mouse states
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Register previous gamepads states
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    }
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    // Register gamepads polled by gamepad polling thread (virtual gamepad)
+    PollGamepadSnapshots();
+#endif
+
+    CORE.Window.resizedLastFrame = false;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Initialize platform: graphics, inputs and more
+int InitPlatform(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_ES3)
+    TRACELOG(LOG_WARNING, "PLATFORM: NULL: OpenGL version not supported, use OpenGL 2.1, 3.3, 4.3 or OpenGL ES 2.0");
+    return -1;
+#else
+
+    // Initialize virtual display: no display, requested screen size is used
+    if ((CORE.Window.screen.width <= 0) || (CORE.Window.screen.height <= 0))
+    {
+        CORE.Window.screen.width = NULL_DISPLAY_WIDTH;
+        CORE.Window.screen.height = NULL_DISPLAY_HEIGHT;
+    }
+
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+
+    if (FLAG_CHECK(CORE.Window.flags, FLAG_FULLSCREEN_MODE)) CORE.Window.fullscreen = true;
+
+    // Virtual display matches requested screen size, no scaling required
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    ResizeFramebufferNull(CORE.Window.render.width, CORE.Window.render.height);
+
+    CORE.Window.ready = true;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully (null display)");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+
+    // Load OpenGL extensions
+    // NOTE: Null driver procedures are provided, drawing is discarded
+    //----------------------------------------------------------------------------
+    rlLoadExtensions(GetProcAddressNull);
+    //----------------------------------------------------------------------------
+
+    // Initialize timing system
+    //----------------------------------------------------------------------------
+    CORE.Time.simulated = true;
+    CORE.Time.simulatedTime = 0.0;
+    InitTimer();
+    //----------------------------------------------------------------------------
+
+    // Initialize storage system
+    //----------------------------------------------------------------------------
+    CORE.Storage.basePath = GetWorkingDirectory();
+    //----------------------------------------------------------------------------
+
+    TRACELOG(LOG_INFO, "PLATFORM: NULL: Initialized successfully");
+
+    return 0;
+#endif
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+    RL_FREE(platform.framebuffer);
+    RL_FREE(platform.clipboardText);
+
+    platform.framebuffer = NULL;
+    platform.clipboardText = NULL;
+}
+
+// Resize CPU framebuffer, content is cleared to clear color
+static void ResizeFramebufferNull(int width, int height)
+{
+    RL_FREE(platform.framebuffer);
+
+    platform.framebuffer = (unsigned char *)RL_MALLOC((size_t)width*height*4);
+    platform.framebufferWidth = width;
+    platform.framebufferHeight = height;
+
+    for (int i = 0; i < width*height; i++) memcpy(platform.framebuffer + i*4, platform.clearColor, 4);
+}
+
+#if !defined(GRAPHICS_API_OPENGL_11) && !defined(GRAPHICS_API_OPENGL_ES3)
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition: OpenGL null driver
+//----------------------------------------------------------------------------------
+// NOTE: Only procedures returning values or filling output parameters are implemented,
+// the rest are mapped to a generic no-op procedure (see LIMITATIONS)
+
+static void GLAD_API_PTR NullProcGL(void) { }
+
+static const GLubyte *GLAD_API_PTR NullGetString(GLenum name)
+{
+    const char *result = "";
+
+    switch (name)
+    {
+        case GL_VENDOR: result = "raylib"; break;
+        case GL_RENDERER: result = "raylib null driver"; break;
+        case GL_VERSION: result = NULL_GL_VERSION; break;
+        case GL_SHADING_LANGUAGE_VERSION: result = "3.30"; break;
+        default: break;
+    }
+
+    return (const GLubyte *)result;
+}
+
+static const GLubyte *GLAD_API_PTR NullGetStringi(GLenum name, GLuint index)
+{
+    return (const GLubyte *)"GL_RAYLIB_null_driver";
+}
+
+static void GLAD_API_PTR NullGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+    #if defined(GL_NUM_EXTENSIONS)
+        case GL_NUM_EXTENSIONS: data[0] = 1; break;
+    #endif
+        case GL_MAX_TEXTURE_SIZE: data[0] = 16384; break;
+        case GL_VIEWPORT:
+        {
+            data[0] = 0;
+            data[1] = 0;
+            data[2] = platform.framebufferWidth;
+            data[3] = platform.framebufferHeight;
+        } break;
+        default: data[0] = 0; break;
+    }
+}
+
+static void GLAD_API_PTR NullGetFloatv(GLenum pname, GLfloat *data) { data[0] = 0.0f; }
+static GLenum GLAD_API_PTR NullGetError(void) { return GL_NO_ERROR; }
+static GLenum GLAD_API_PTR NullCheckFramebufferStatus(GLenum target) { return GL_FRAMEBUFFER_COMPLETE; }
+static GLuint GLAD_API_PTR NullCreateShader(GLenum type) { return ++platform.lastObjectId; }
+static GLuint GLAD_API_PTR NullCreateProgram(void) { return ++platform.lastObjectId; }
+static GLint GLAD_API_PTR NullGetLocation(GLuint program, const GLchar *name) { return 0; }
+static void *GLAD_API_PTR NullMapBuffer(GLenum target, GLenum access) { return NULL; }
+static GLboolean GLAD_API_PTR NullUnmapBuffer(GLenum target) { return GL_TRUE; }
+
+static void GLAD_API_PTR NullGenObjects(GLsizei n, GLuint *ids)
+{
+    for (int i = 0; i < n; i++) ids[i] = ++platform.lastObjectId;
+}
+
+static void GLAD_API_PTR NullGetObjectiv(GLuint object, GLenum pname, GLint *params)
+{
+    params[0] = ((pname == GL_COMPILE_STATUS) || (pname == GL_LINK_STATUS))? GL_TRUE : 0;
+}
+
+static void GLAD_API_PTR NullGetObjectInfoLog(GLuint object, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) length[0] = 0;
+    if ((infoLog != NULL) && (bufSize > 0)) infoLog[0] = '\0';
+}
+
+static void GLAD_API_PTR NullGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+{
+    if (length != NULL) length[0] = 0;
+    if (size != NULL) size[0] = 0;
+    if (type != NULL) type[0] = 0;
+    if ((name != NULL) && (bufSize > 0)) name[0] = '\0';
+}
+
+static void GLAD_API_PTR NullGetParameteriv3(GLenum target, GLint level, GLenum pname, GLint *params) { params[0] = 0; }
+static void GLAD_API_PTR NullGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { memset(data, 0, size); }
+
+static void GLAD_API_PTR NullBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    platform.boundFramebuffer = framebuffer;
+}
+
+static void GLAD_API_PTR NullClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    platform.clearColor[0] = (unsigned char)(red*255.0f);
+    platform.clearColor[1] = (unsigned char)(green*255.0f);
+    platform.clearColor[2] = (unsigned char)(blue*255.0f);
+    platform.clearColor[3] = (unsigned char)(alpha*255.0f);
+}
+
+// Clear CPU framebuffer, only if bound
+static void GLAD_API_PTR NullClear(GLbitfield mask)
+{
+    if ((platform.boundFramebuffer != 0) || !(mask & GL_COLOR_BUFFER_BIT) || (platform.framebuffer == NULL)) return;
+
+    for (int i = 0; i < platform.framebufferWidth*platform.framebufferHeight; i++) memcpy(platform.framebuffer + i*4, platform.clearColor, 4);
+}
+
+// Read CPU framebuffer pixels (RGBA, 8 bit per channel), out of bounds pixels are zeroed
+static void GLAD_API_PTR NullReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    if ((format != GL_RGBA) || (type != GL_UNSIGNED_BYTE)) return;
+
+    unsigned char *data = (unsigned char *)pixels;
+    memset(data, 0, (size_t)width*height*4);
+
+    if ((platform.boundFramebuffer != 0) || (platform.framebuffer == NULL)) return;
+
+    for (int j = 0; j < height; j++)
+    {
+        int row = y + j;
+        if ((row < 0) || (row >= platform.framebufferHeight)) continue;
+
+        for (int i = 0; i < width; i++)
+        {
+            int col = x + i;
+            if ((col < 0) || (col >= platform.framebufferWidth)) continue;
+
+            memcpy(data + (j*width + i)*4, platform.framebuffer + (row*platform.framebufferWidth + col)*4, 4);
+        }
+    }
+}
+
+// Get null driver OpenGL procedure address
+static GLADapiproc GetProcAddressNull(const char *name)
+{
+    static const struct { const char *name; GLADapiproc proc; } procs[] = {
+        { "glGetString", (GLADapiproc)NullGetString },
+        { "glGetStringi", (GLADapiproc)NullGetStringi },
+        { "glGetIntegerv", (GLADapiproc)NullGetIntegerv },
+        { "glGetFloatv", (GLADapiproc)NullGetFloatv },
+        { "glGetError", (GLADapiproc)NullGetError },
+        { "glCheckFramebufferStatus", (GLADapiproc)NullCheckFramebufferStatus },
+        { "glCreateShader", (GLADapiproc)NullCreateShader },
+        { "glCreateProgram", (GLADapiproc)NullCreateProgram },
+        { "glGetUniformLocation", (GLADapiproc)NullGetLocation },
+        { "glGetAttribLocation", (GLADapiproc)NullGetLocation },
+        { "glMapBuffer", (GLADapiproc)NullMapBuffer },
+        { "glUnmapBuffer", (GLADapiproc)NullUnmapBuffer },
+        { "glGenTextures", (GLADapiproc)NullGenObjects },
+        { "glGenBuffers", (GLADapiproc)NullGenObjects },
+        { "glGenVertexArrays", (GLADapiproc)NullGenObjects },
+        { "glGenVertexArraysOES", (GLADapiproc)NullGenObjects },
+        { "glGenFramebuffers", (GLADapiproc)NullGenObjects },
+        { "glGenRenderbuffers", (GLADapiproc)NullGenObjects },
+        { "glGetShaderiv", (GLADapiproc)NullGetObjectiv },
+        { "glGetProgramiv", (GLADapiproc)NullGetObjectiv },
+        { "glGetShaderInfoLog", (GLADapiproc)NullGetObjectInfoLog },
+        { "glGetProgramInfoLog", (GLADapiproc)NullGetObjectInfoLog },
+        { "glGetActiveUniform", (GLADapiproc)NullGetActiveUniform },
+        { "glGetTexLevelParameteriv", (GLADapiproc)NullGetParameteriv3 },
+        { "glGetFramebufferAttachmentParameteriv", (GLADapiproc)NullGetParameteriv3 },
+        { "glGetBufferParameteri64v", (GLADapiproc)NullGetParameteriv3 },
+        { "glGetBufferSubData", (GLADapiproc)NullGetBufferSubData },
+        { "glBindFramebuffer", (GLADapiproc)NullBindFramebuffer },
+        { "glClearColor", (GLADapiproc)NullClearColor },
+        { "glClear", (GLADapiproc)NullClear },
+        { "glReadPixels", (GLADapiproc)NullReadPixels },
+    };
+
+    for (int i = 0; i < (int)(sizeof(procs)/sizeof(procs[0])); i++)
+    {
+        if (strcmp(procs[i].name, name) == 0) return procs[i].proc;
+    }
+
+    return (GLADapiproc)NullProcGL;
+}
+#endif  // !GRAPHICS_API_OPENGL_11 && !GRAPHICS_API_OPENGL_ES3
+
+// EOF
@@ -337,6 +337,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds since InitTimer()
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     double time = 0.0;
     struct timespec ts = { 0 };
     clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -438,6 +440,9 @@ void PollInputEvents(void)
         CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
     }
 
+    // NOTE: Touch and gamepad states are polled, transitions are timestamped at poll time
+    unsigned long long timestamp = (unsigned long long)(GetTime()*1000000000.0);
+
     HidTouchScreenState state = {0};
     if (hidGetTouchScreenStates(&state, 1))
     {
@@ -454,6 +459,8 @@ void PollInputEvents(void)
             platform.touchDeltaTime[i] = state.touches[i].delta_time;
         }
         CORE.Input.Touch.pointCount = state.count;
+
+        for (int i = 0; i < MAX_TOUCH_POINTS; i++) RegisterInputEvent(INPUT_EVENT_TOUCH, i, CORE.Input.Touch.pointId[i], (i < state.count), timestamp);
     }
 
     for (int i = 0; i < MAX_GAMEPADS; i++)
@@ -502,10 +509,10 @@ void PollInputEvents(void)
                     case GAMEPAD_BUTTON_RIGHT_THUMB: kButton = HidNpadButton_StickR; break;
                 }
                 if (kHeld & kButton) {
-                    CORE.Input.Gamepad.currentButtonState[i][k] = 1;
+                    RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, k, true, timestamp);
                     CORE.Input.Gamepad.lastButtonPressed = k;
                 } else {
-                    CORE.Input.Gamepad.currentButtonState[i][k] = 0;
+                    RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, i, k, false, timestamp);
                 }
             }
 
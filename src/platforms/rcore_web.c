@@ -876,6 +876,8 @@ void SwapScreenBuffer(void)
 // Get elapsed time measure in seconds since InitTimer()
 double GetTime(void)
 {
+    if (CORE.Time.simulated) return CORE.Time.simulatedTime;   // Simulated clock, see EnableSimulatedClock()
+
     double time = glfwGetTime();   // Elapsed time since glfwInit()
     return time;
 }
@@ -1491,8 +1493,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 
     // WARNING: GLFW could return GLFW_REPEAT, we need to consider it as 1
     // to work properly with our implementation (IsKeyDown/IsKeyUp checks)
-    if (action == GLFW_RELEASE) CORE.Input.Keyboard.currentKeyState[key] = 0;
-    else if(action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
+    if (action == GLFW_RELEASE) RegisterInputEvent(INPUT_EVENT_KEY, 0, key, false, 0);
+    else if(action == GLFW_PRESS) RegisterInputEvent(INPUT_EVENT_KEY, 0, key, true, 0);
     else if(action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
     // Check if there is space available in the key queue
@@ -1531,7 +1533,7 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
 {
     // WARNING: GLFW could only return GLFW_PRESS (1) or GLFW_RELEASE (0) for now,
     // but future releases may add more actions (i.e. GLFW_REPEAT)
-    CORE.Input.Mouse.currentButtonState[button] = action;
+    RegisterInputEvent(INPUT_EVENT_MOUSE_BUTTON, 0, button, (action == GLFW_PRESS), 0);
     CORE.Input.Touch.currentTouchState[button] = action;
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
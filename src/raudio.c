@@ -195,6 +195,22 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf(), logf(), expf(), cosf(), sinf() [Used in LoadWaveRhythm(), GetAudioSpectrum()]
+
+// Mixer SIMD kernels, selected depending on target architecture compiler flags
+// NOTE: Define RAUDIO_NO_SIMD to use the scalar kernels only (i.e. to compare performance)
+#if defined(RAUDIO_NO_SIMD)
+    // Scalar kernels only
+#elif defined(__AVX2__)
+    #define RAUDIO_SIMD_AVX2
+    #include <immintrin.h>              // Required for: AVX intrinsics [Used in mixer kernels]
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define RAUDIO_SIMD_SSE2
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics [Used in mixer kernels]
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define RAUDIO_SIMD_NEON
+    #include <arm_neon.h>               // Required for: NEON intrinsics [Used in mixer kernels]
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -310,6 +326,62 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                  64    // Maximum number of sound instances playing at once (voice pool)
+#endif
+#ifndef MAX_AUDIO_COMMANDS
+    #define MAX_AUDIO_COMMANDS              1024    // Maximum pending mixer commands, must be a power of 2
+#endif
+#ifndef MAX_AUDIO_BUSES
+    #define MAX_AUDIO_BUSES                    8    // Maximum number of audio buses (submixes), first ones are AudioBusType
+#endif
+#ifndef MAX_AUDIO_BUS_EFFECTS
+    #define MAX_AUDIO_BUS_EFFECTS              4    // Maximum number of effects on a bus effects chain
+#endif
+
+#ifndef MUSIC_SEEK_INDEX_STEP
+    #define MUSIC_SEEK_INDEX_STEP           1152    // Music seek index step in frames (MP3 frame size), seeks decode up to one step
+#endif
+
+#ifndef AUDIO_ANALYSIS_THREADS
+    #define AUDIO_ANALYSIS_THREADS             4    // Maximum number of threads used for wave analysis
+#endif
+
+#ifndef PI
+    #define PI 3.14159265358979323846f
+#endif
+
+#define AUDIO_ANALYSIS_FFT_SIZE         1024    // Wave analysis FFT size in frames, must be a power of 2
+#define AUDIO_ANALYSIS_HOP_SIZE          512    // Wave analysis hop size in frames between FFT windows
+#define AUDIO_ANALYSIS_MIN_BPM          60.0f   // Wave analysis minimum tempo detected
+#define AUDIO_ANALYSIS_MAX_BPM         200.0f   // Wave analysis maximum tempo detected
+
+#define AUDIO_SPECTRUM_RING_FRAMES      4096    // Spectrum tap ring size in frames, must be a power of 2
+#define AUDIO_SPECTRUM_MIN_DB          -60.0f   // Spectrum bands level mapped to 0.0f (0 dB mapped to 1.0f)
+
+#define AUDIO_BUS_FRAMES                1024    // Audio buses mixing chunk size in frames
+#define AUDIO_BUS_DUCKING_LEVEL        0.001f   // Ducking trigger bus peak level considered as playing (-60 dB)
+#define AUDIO_EFFECT_REVERB_LINES         12    // Reverb delay lines: 4 comb filters and 2 allpass filters per channel
+
+#define AUDIO_STATS_HISTOGRAM_BINS        64    // Mixer callback duration histogram bins, 4 bins per octave of microseconds
+#define AUDIO_STATS_MAX_PROCESSORS        16    // Maximum number of processor callbacks timed separately
+
+#define MUSIC_STRETCH_WINDOW_MS           30    // Music time-stretch window length in milliseconds, windows overlap by half
+#define MUSIC_STRETCH_SEEK_MS              8    // Music time-stretch similarity search range in milliseconds (both directions)
+#define MUSIC_TEMPO_MIN                 0.25f   // Music minimum tempo supported by time-stretch
+#define MUSIC_TEMPO_MAX                 4.0f    // Music maximum tempo supported by time-stretch
+
+#if ((MAX_AUDIO_COMMANDS & (MAX_AUDIO_COMMANDS - 1)) != 0)
+    #error "MAX_AUDIO_COMMANDS must be a power of 2"
+#endif
+#if (MAX_AUDIO_VOICES > 0xffff)
+    #error "MAX_AUDIO_VOICES must fit in sound instance id low 16 bits"
+#endif
+#if (MAX_AUDIO_BUSES < 4)
+    #error "MAX_AUDIO_BUSES must include AudioBusType buses"
+#endif
+
+#define AUDIO_CLOCK_NEVER   (~(ma_uint64)0) // Audio clock frame for events never happening
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -350,26 +422,152 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Music decoder, decodes music on a background thread
+// NOTE: Decoded frames are written to a ring buffer read by the mixer, music context
+// is only accessed by the decoder thread, program must lock the decoder to access it
+typedef struct MusicDecoder {
+    Music music;                    // Music decoded, context data shared with program
+    ma_pcm_rb ring;                 // Decoded frames ring buffer (single producer, single consumer)
+    ma_thread thread;               // Decoder thread
+    ma_mutex lock;                  // Decoder lock, protects music context and decoder position
+    ma_uint32 sleepTime;            // Decoder thread sleep time between refills (milliseconds)
+    ma_uint32 framesDecoded;        // Decoder position in music frames
+    ma_bool32 running;              // Decoder thread running
+    ma_bool32 looping;              // Music looping, updated on UpdateMusicStream()
+    ma_bool32 finished;             // Music fully decoded (not looping)
+    ma_uint32 underruns;            // Number of mixer reads with not enough decoded frames
+    struct MusicStretch *stretch;   // Music time-stretch, loaded on first tempo change
+} MusicDecoder;
+
+// Music time-stretch (WSOLA), changes music tempo keeping its pitch
+// NOTE: Input windows are picked around their nominal position (tempo scaled) for the best
+// similarity with previous window continuation, then overlap-added at a fixed hop
+typedef struct MusicStretch {
+    float *input;                   // Input frames (interleaved), decoded from music
+    float *mono;                    // Input frames downmixed to mono, used for similarity search
+    float *overlap;                 // Previous window second half, windowed, overlapped with next window
+    float *output;                  // Output frames (interleaved), one hop
+    float *window;                  // Window first half (Hann)
+    float *fade;                    // Window second half, 1.0f minus first half
+    void *pcm;                      // Music frames decoding buffer, music sample format
+    ma_format format;               // Music sample format
+    ma_uint32 channels;             // Music channels
+    ma_uint32 hop;                  // Output hop in frames, half window length
+    ma_uint32 seek;                 // Similarity search range in frames
+    ma_uint32 capacity;             // Input capacity in frames
+    ma_uint32 count;                // Input frames available
+    ma_uint32 end;                  // Input frame where music ended (not looping)
+    ma_uint32 natural;              // Previous window natural continuation, input frame
+    double position;                // Next window nominal position, input frame
+    ma_uint32 outputCursor;         // Output frames already written to decoder ring
+    bool primed;                    // Input started, time-stretch is kept running until reset
+    bool ended;                     // Music end reached, input padded with silence
+} MusicStretch;
+
+// Wave spectral flux analysis task, processes a range of analysis windows
+// NOTE: FFT tables are shared read-only by all tasks, every task uses its own work buffers
+typedef struct WaveFluxTask {
+    const float *samples;           // Wave mono samples
+    const float *window;            // Analysis window (Hann), AUDIO_ANALYSIS_FFT_SIZE values
+    const float *twiddleRe;         // FFT twiddles real part, AUDIO_ANALYSIS_FFT_SIZE values
+    const float *twiddleIm;         // FFT twiddles imaginary part, AUDIO_ANALYSIS_FFT_SIZE values
+    const int *bitReverse;          // FFT bit-reversal permutation, AUDIO_ANALYSIS_FFT_SIZE values
+    float *flux;                    // Spectral flux output, one value per analysis window
+    int first;                      // First analysis window processed
+    int last;                       // Last analysis window processed (not included)
+} WaveFluxTask;
+
+// Audio parameter ramp, scheduled on audio clock
+// NOTE: Parameter value is linearly interpolated from current value to target value
+typedef struct AudioRamp {
+    float target;                   // Ramp target value
+    ma_uint64 startFrame;           // Ramp start frame on audio clock
+    ma_uint32 length;               // Ramp length in frames (0 for an immediate change at start frame)
+    bool active;                    // Ramp is pending or in progress
+} AudioRamp;
+
+// Audio playhead anchor, relates a position to the audio clock
+// NOTE: Anchor is written by the mixer every period inside a sequence lock, readers
+// never lock the mixer, they retry while the sequence is odd (writing) or has changed
+typedef struct AudioPlayhead {
+    ma_uint32 sequence;             // Sequence lock counter, odd while the mixer is writing
+    ma_uint64 clock;                // Audio clock frame of the anchor
+    ma_uint64 position;             // Position at anchor: source frame (streams) or monotonic time in nanoseconds (device)
+    float rate;                     // Source frames advanced per audio clock frame (0.0f if not playing)
+} AudioPlayhead;
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Compressed sound data, QOA encoded in memory, shared by the sound, its aliases and the voices playing it
+// NOTE: QOA frames have a fixed size (last one excepted), so any frame is addressed without parsing previous ones
+typedef struct AudioCompressed {
+    unsigned char *data;            // QOA encoded data, file header included
+    unsigned int dataSize;          // QOA encoded data size in bytes
+    unsigned int frameCount;        // Sound frames count
+    unsigned int channels;          // Sound channels (AUDIO_DEVICE_CHANNELS)
+} AudioCompressed;
+
+// Compressed sound decoding cursor, one per buffer playing compressed data (mixer side)
+// NOTE: Slices are decoded one at a time into a small window, LMS state carries on from previous slice
+typedef struct AudioCompressedCursor {
+    qoa_lms_t lms[AUDIO_DEVICE_CHANNELS]; // LMS predictor state per channel, after last slice decoded
+    short window[QOA_SLICE_LEN*AUDIO_DEVICE_CHANNELS]; // Frames of last slice decoded
+    ma_uint32 windowFrame;          // Sound frame of window first frame
+    ma_uint32 windowCount;          // Frames in window, 0 if nothing decoded yet
+    ma_uint32 nextFrame;            // Sound frame of next slice, sequential decoding continues from there
+} AudioCompressedCursor;
+#endif
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
+    ma_format format;               // Audio data format, signed 16 bit data is converted to float before the converter (SIMD)
 
     AudioCallback callback;         // Audio buffer callback for buffer filling on audio threads
     rAudioProcessor *processor;     // Audio processor
+    MusicDecoder *decoder;          // Music decoder, filling buffer from a background thread (if enabled)
+    ma_pcm_rb *ring;                // Stream frames ring buffer, filled by PushAudioStreamFrames() (single producer, single consumer)
+    ma_uint32 underruns;            // Number of mixer reads with not enough frames in ring
+    ma_uint32 overruns;             // Number of pushes with not enough space in ring
+    struct AudioCompressed *compressed; // Compressed sound data decoded on demand, instead of data (QOA)
+    struct AudioCompressedCursor *cursor; // Compressed sound decoding cursor, allocated on first compressed play
 
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
-
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    float levels[2];                // Audio buffer stereo levels, volume and pan law applied
+    AudioRamp volumeRamp;           // Audio buffer scheduled volume ramp
+    AudioRamp panRamp;              // Audio buffer scheduled pan ramp
+    float fade;                     // Audio buffer transition fade, applied over volume (mixer side)
+    AudioRamp fadeRamp;             // Audio buffer transition fade ramp, used by queued streams crossfades
+
+    ma_uint64 startFrame;           // Scheduled start frame on audio clock (0 to start immediately)
+    ma_uint64 stopFrame;            // Scheduled stop frame on audio clock (AUDIO_CLOCK_NEVER if not scheduled)
+
+    ma_bool32 playing;              // Audio buffer state: AUDIO_PLAYING (mixer side)
+    ma_bool32 paused;               // Audio buffer state: AUDIO_PAUSED (mixer side)
+    ma_bool32 requestPlaying;       // Requested state: playing, reported until the mixer applies it (program side)
+    ma_bool32 requestPaused;        // Requested state: paused, reported until the mixer applies it (program side)
+    ma_uint32 requestTicket;        // Requested state command ticket, request is pending until the mixer applies it (program side)
+    ma_uint32 unloadTicket;         // Untrack command ticket, unloaded buffer is freed once the mixer applies it (program side)
+    rAudioBuffer *unloadNext;       // Next buffer on unloaded buffers list, pending to be freed (program side)
+    bool isAlias;                   // Buffer shares its data with a source sound (alias), data is not freed with the buffer
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
+    int maxInstances;               // Maximum sound instances playing at once from voice pool (0 for no limit)
+    int bus;                        // Audio buffer output bus, mixer side (AudioBusType or user bus index)
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_bool32 isSubBufferProcessed[2]; // SubBuffer processed (virtual double buffer)
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    ma_uint64 framesRead;           // Source frames read by the mixer since play or seek (mixer side)
+    float tempo;                    // Music tempo, time-stretched by music decoder (1.0f for none)
+    double tempoFrames;             // Music frames read fractional part, scaled by tempo (mixer side)
+    rAudioBuffer *queued;           // Stream queued to play next, transition pending (mixer side)
+    ma_uint32 queuedLength;         // Queued transition: stream length in source frames, to find its end
+    ma_uint32 queuedFadeFrames;     // Queued transition: crossfade length in frames (audio clock)
+    bool queuedGapless;             // Queued transition: wait for the stream end, otherwise transition right away
+    AudioPlayhead playhead;         // Stream playhead anchor, published by the mixer every period
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
@@ -381,27 +579,208 @@ struct rAudioBuffer {
 // NOTE: Useful to apply effects to an AudioBuffer
 struct rAudioProcessor {
     AudioCallback process;          // Processor callback function
+    int stats;                      // Processor callback timing stats index, -1 if not timed
     rAudioProcessor *next;          // Next audio processor on the list
     rAudioProcessor *prev;          // Previous audio processor on the list
 };
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio bus built-in effect
+// NOTE: Effect is allocated by the program and owned by the mixer once added to a bus chain
+typedef struct AudioEffect {
+    int type;                       // Effect type: AudioEffectType
+    float params[4];                // Effect parameters, meaning depends on type
+    float coeffs[5];                // Effect coefficients computed from parameters (biquad: b0, b1, b2, a1, a2)
+    float state[4];                 // Biquad filter state per channel (transposed direct form II): z1[2], z2[2]
+    float envelope;                 // Compressor/limiter envelope level
+    float *lines[AUDIO_EFFECT_REVERB_LINES];    // Reverb delay lines, all of them share lines[0] allocation
+    int lineLength[AUDIO_EFFECT_REVERB_LINES];  // Reverb delay lines length in frames
+    int lineIndex[AUDIO_EFFECT_REVERB_LINES];   // Reverb delay lines position
+    float damping[AUDIO_EFFECT_REVERB_LINES];   // Reverb comb filters damping state
+} AudioEffect;
+
+// Audio command type
+// NOTE: Commands are pushed by the program thread(s) and processed by the mixer,
+// they are the only way to modify the state owned by the mixer while playing
+typedef enum {
+    AUDIO_COMMAND_NONE = 0,
+    AUDIO_COMMAND_TRACK,            // Add audio buffer to the mixer list
+    AUDIO_COMMAND_UNTRACK,          // Remove audio buffer from the mixer list
+    AUDIO_COMMAND_PLAY,             // Play audio buffer from the start, at a scheduled frame
+    AUDIO_COMMAND_STOP,             // Stop audio buffer
+    AUDIO_COMMAND_STOP_SCHEDULED,   // Stop audio buffer at a scheduled frame
+    AUDIO_COMMAND_PAUSE,            // Pause audio buffer
+    AUDIO_COMMAND_RESUME,           // Resume audio buffer
+    AUDIO_COMMAND_SEEK,             // Set audio buffer frame cursor position (sounds)
+    AUDIO_COMMAND_VOLUME,           // Set audio buffer volume
+    AUDIO_COMMAND_PITCH,            // Set audio buffer pitch
+    AUDIO_COMMAND_PAN,              // Set audio buffer pan
+    AUDIO_COMMAND_VOLUME_RAMP,      // Ramp audio buffer volume at a scheduled frame
+    AUDIO_COMMAND_PAN_RAMP,         // Ramp audio buffer pan at a scheduled frame
+    AUDIO_COMMAND_RESET,            // Reset audio stream sub-buffers, used on music seeking
+    AUDIO_COMMAND_CALLBACK,         // Set audio stream callback
+    AUDIO_COMMAND_DECODER,          // Set audio stream music decoder
+    AUDIO_COMMAND_RING,             // Set audio stream frames ring buffer
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Attach processor to audio buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Detach processor from audio buffer (or mixed output if no buffer)
+    AUDIO_COMMAND_VOICE_PLAY,       // Play sound buffer (source) on a voice from the start
+    AUDIO_COMMAND_BUS,              // Set audio buffer output bus
+    AUDIO_COMMAND_BUS_VOLUME,       // Set bus volume
+    AUDIO_COMMAND_BUS_DUCKING,      // Set bus ducking, from a trigger bus
+    AUDIO_COMMAND_BUS_ADD_EFFECT,   // Add effect to bus effects chain
+    AUDIO_COMMAND_BUS_EFFECT_PARAM, // Set bus effect parameter
+    AUDIO_COMMAND_BUS_CLEAR_EFFECTS,    // Remove all effects from bus effects chain
+    AUDIO_COMMAND_BUS_ATTACH_PROCESSOR, // Attach processor to bus
+    AUDIO_COMMAND_BUS_DETACH_PROCESSOR, // Detach processor from bus
+    AUDIO_COMMAND_QUEUE             // Queue stream (source) to play after audio buffer
+} AudioCommandType;
+
+// Audio command, sent to the mixer
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Command audio buffer, NULL for commands on mixed output
+    AudioBuffer *source;            // Command source sound buffer, played by a voice
+    rAudioProcessor *processor;     // Command processor to attach
+    AudioCallback callback;         // Command callback (stream callback or processor to detach)
+    MusicDecoder *decoder;          // Command music decoder
+    ma_pcm_rb *ring;                // Command frames ring buffer
+    AudioEffect *effect;            // Command bus effect
+    int bus;                        // Command bus index
+    float value;                    // Command value: volume, pitch, pan
+    float values[3];                // Command additional values: ducking amount, attack and release
+    unsigned int frames;            // Command frames: frames processed on reset, ramp length, seek position
+    bool flag;                      // Command flag: gapless transition
+    ma_uint64 frame;                // Command scheduled frame on audio clock
+} AudioCommand;
+
+// Audio command queue cell
+// NOTE: Bounded multi-producer queue, every cell sequence number tells if it is ready to be
+// written or read, it is stored relative to the cell index so a zero-initialized queue is valid
+typedef struct AudioCommandCell {
+    ma_uint32 sequence;             // Cell sequence number (minus cell index)
+    AudioCommand command;           // Cell command
+} AudioCommandCell;
+
+// Voice from the voice pool, plays sound instances
+// NOTE: Voice buffer shares data with the sound buffer played, program side
+// fields are protected by the voice pool lock, mixer only uses the buffer
+typedef struct AudioVoice {
+    AudioBuffer *buffer;            // Voice audio buffer, not tracked in the mixer list
+    AudioBuffer *source;            // Sound buffer played by the voice, NULL if voice is free
+    unsigned int id;                // Sound instance id: generation (high bits) and voice index (low bits)
+    int priority;                   // Sound instance priority, higher priority instances are never stolen
+    ma_uint32 order;                // Play order, used for oldest voice stealing
+    ma_uint32 ticket;               // Play command ticket, voice is busy until the command is applied
+    float level;                    // Voice current volume, updated by the mixer, used for quietest voice stealing
+    bool active;                    // Voice is in the mixer active voices array (mixer side)
+    bool reserved;                  // Voice selected to play, play command not pushed yet (program side)
+} AudioVoice;
+
+// Audio bus (submix), sources mix into their bus and the bus is processed once before mixing it to output
+// NOTE: Mixer side fields are only accessed by the mixer, program side ones track effects to be freed
+typedef struct AudioBus {
+    float frames[AUDIO_BUS_FRAMES*AUDIO_DEVICE_CHANNELS]; // Bus mixing buffer, one chunk of frames
+    bool active;                    // Bus has frames on current chunk (mixer side)
+    float peak;                     // Bus peak level on current chunk, effects applied (mixer side)
+    float volume;                   // Bus volume (mixer side)
+    float gain;                     // Bus gain on last chunk, volume with ducking applied (mixer side)
+    int duckTrigger;                // Ducking trigger bus, -1 if ducking disabled (mixer side)
+    float duckAmount;               // Ducking amount, volume reduction while trigger bus is playing [0..1]
+    float duckAttack;               // Ducking attack time in seconds
+    float duckRelease;              // Ducking release time in seconds
+    float duckLevel;                // Ducking current level [0..1]
+    AudioEffect *effects[MAX_AUDIO_BUS_EFFECTS]; // Bus effects chain (mixer side)
+    int effectCount;                // Bus effects chain count (mixer side)
+    rAudioProcessor *processor;     // Bus processors (mixer side)
+    AudioEffect *loaded[MAX_AUDIO_BUS_EFFECTS];  // Bus effects loaded (program side)
+    int loadedCount;                // Bus effects loaded count (program side)
+} AudioBus;
+
+// Processor callback timing stats, shared by all processors attached with the same callback
+// NOTE: Slots are claimed by the program when attaching processors, counters are written by the mixer
+typedef struct AudioProcessorStats {
+    void *process;                  // Processor callback function, NULL if slot is free
+    ma_uint64 time;                 // Mixer time spent on callback (nanoseconds)
+} AudioProcessorStats;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock, protects pcmBuffer (never locked by the mixer)
+        ma_spinlock mixLock;        // Mixer lock, audio thread only try-locks it, never blocks
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Offline mode, no device, mixer driven by RenderAudioFrames()
+        ma_uint32 sampleRate;       // Mixer output sample rate (device sample rate)
+        ma_uint32 channels;         // Mixer output channels (device channels)
+        ma_uint32 periodSize;       // Mixer period size in frames (device period size)
+        float masterVolume;         // Master volume, applied by the mixer
+        ma_uint64 framesRendered;   // Audio clock, total frames rendered by the mixer
+        ma_timer timer;             // Monotonic timer, used to interpolate the audio clock between periods
+        AudioPlayhead output;       // Device period anchor: audio clock at period start and its time
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
+        AudioBuffer *unloaded;      // Buffers unloaded by the program, pending to be freed once untracked by the mixer
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommandCell queue[MAX_AUDIO_COMMANDS]; // Commands queue, pushed by program and processed by mixer
+        ma_uint32 head;             // Commands queue head, next position to write
+        ma_uint32 tail;             // Commands queue tail, next position to read (total processed commands)
+        rAudioProcessor *garbage;   // Processors detached by the mixer, pending to be freed
+    } Command;
+    struct {
+        float ring[AUDIO_SPECTRUM_RING_FRAMES*AUDIO_DEVICE_CHANNELS]; // Mixed output frames, written by mixer
+        ma_uint32 framesWritten;    // Total frames written to ring (ring position)
+        ma_bool32 enabled;          // Spectrum tap enabled, mixer only copies frames when enabled
+        float window[AUDIO_ANALYSIS_FFT_SIZE];      // FFT analysis window (Hann)
+        float twiddleRe[AUDIO_ANALYSIS_FFT_SIZE];   // FFT twiddles real part
+        float twiddleIm[AUDIO_ANALYSIS_FFT_SIZE];   // FFT twiddles imaginary part
+        int bitReverse[AUDIO_ANALYSIS_FFT_SIZE];    // FFT bit-reversal permutation
+    } Spectrum;
+    struct {
+        AudioVoice pool[MAX_AUDIO_VOICES];      // Voices pool
+        AudioVoice *active[MAX_AUDIO_VOICES];   // Voices being mixed, stored contiguously (mixer side)
+        int activeCount;            // Number of voices being mixed (mixer side)
+        ma_spinlock lock;           // Voices pool lock, protects program side voices state (never locked by the mixer)
+        ma_uint32 order;            // Play order counter
+        int stealMode;              // Voices stealing mode: AudioVoiceStealMode
+    } Voice;
+    struct {
+        ma_uint32 soundCount;       // Number of sounds loaded (aliases not included)
+        ma_uint64 soundMemory;      // Sounds data memory, converted to device format (bytes)
+        ma_uint64 framesDirect;     // Frames mixed on direct path, straight from sound data
+        ma_uint64 framesConverted;  // Frames mixed through data converter
+        ma_uint32 compressedCount;  // Number of compressed sounds loaded
+        ma_uint64 compressedMemory; // Compressed sounds encoded data memory (bytes)
+        ma_uint64 compressedSaved;  // Compressed sounds memory saved, compared to device format data (bytes)
+        ma_uint64 framesDecoded;    // Frames decoded on demand from compressed sounds
+        ma_uint64 decodeTime;       // Time spent decoding compressed sounds on mixer (nanoseconds)
+        ma_uint64 callbackCount;    // Mixer callbacks (device periods) mixed
+        ma_uint64 callbackFrames;   // Frames mixed by callbacks, periods duration
+        ma_uint64 callbackTime;     // Mixer time spent on callbacks (nanoseconds)
+        ma_uint64 callbackTimeMax;  // Mixer longest callback (nanoseconds)
+        ma_uint32 callbackLoadMax;  // Mixer highest callback load, fraction of period duration (millionths)
+        ma_uint32 callbackHistogram[AUDIO_STATS_HISTOGRAM_BINS]; // Mixer callbacks duration histogram
+        ma_uint64 processorTime;    // Mixer time spent on processors (nanoseconds)
+        AudioProcessorStats processors[AUDIO_STATS_MAX_PROCESSORS]; // Processor callbacks timing
+        ma_uint32 activeVoices;     // Sources mixed on last callback
+        ma_uint32 activeResamplers; // Sources mixed through data converter on last callback
+        ma_uint32 deadlineMisses;   // Callbacks longer than their period duration
+        ma_uint32 xruns;            // Device periods output as silence or callbacks started late
+        ma_uint32 streamUnderruns;  // Stream reads short of frames (music decoders and pushed frames rings)
+        int mixedVoices;            // Sources mixed on current callback, maximum of its chunks (mixer side)
+        int mixedResamplers;        // Sources mixed through data converter on current callback (mixer side)
+        double lastCallback;        // Last device callback start time in seconds (mixer side)
+        double lastPeriod;          // Last device callback period duration in seconds (mixer side)
+    } Stats;
+    AudioBus buses[MAX_AUDIO_BUSES];    // Audio buses (submixes), mixed before mixed processors
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -415,6 +794,7 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .System.masterVolume = 1.0f,
     .mixedProcessor = NULL
 };
 
@@ -425,14 +805,98 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 
 // Reads audio data from an AudioBuffer object in internal/device formats
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static ma_uint32 ReadAudioStreamRingFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static ma_uint32 ReadAudioCompressedFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static void DecodeAudioCompressedSlice(const AudioCompressed *compressed, AudioCompressedCursor *cursor, ma_uint32 frame);
+#endif
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioOutputInLockedState(float *framesOut, ma_uint32 frameCount);
+static void MixAudioBusesInLockedState(float *framesOut, ma_uint32 frameCount, ma_uint64 clock);
+static void MixAudioBufferInLockedState(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount, ma_uint64 clock);
+static void MixAudioBufferFrames(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 framesStart, ma_uint32 framesEnd, ma_uint64 clock);
+static void MixAudioBufferFramesDirect(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 framesStart, ma_uint32 framesEnd, ma_uint64 clock);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static void MixAudioBufferFramesCompressed(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 framesStart, ma_uint32 framesEnd, ma_uint64 clock);
+#endif
+static bool IsAudioBufferDirect(AudioBuffer *audioBuffer);
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer, ma_uint64 clock);
+static float GetAudioRampValue(float value, const AudioRamp *ramp, ma_uint64 frame);
+static bool UpdateAudioRamp(float *value, AudioRamp *ramp, ma_uint64 frame);
+static void UpdateAudioBufferLevels(AudioBuffer *buffer);
+
+static void MixAudioSamplesStereo(float *framesOut, const float *framesIn, ma_uint32 frameCount, float left, float right);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float volume);
+static void ConvertAudioSamplesS16ToF32(float *samplesOut, const short *samplesIn, ma_uint32 sampleCount);
+static void ConvertAudioSamplesF32ToS16(short *samplesOut, const float *samplesIn, ma_uint32 sampleCount);
+static void ApplyAudioMasterVolume(float *samples, ma_uint32 sampleCount, float volume);
+static void MixAudioSamplesRamp(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, float gainStart, float gainEnd);
+static void ApplyAudioFrameGains(float *frames, const float *gains, ma_uint32 frameCount, ma_uint32 channels);
+static float GetAudioSamplesPeak(const float *samples, ma_uint32 sampleCount);
+static void ApplyAudioProcessors(rAudioProcessor *processor, void *frames, ma_uint32 frameCount);
+static float GetAudioSamplesDot(const float *a, const float *b, ma_uint32 sampleCount);
+static void DownmixAudioFrames(float *samplesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels);
+static void OverlapAddAudioFrames(float *framesOut, float *overlap, const float *framesIn, const float *framesNext, const float *window, const float *fade, ma_uint32 frameCount, ma_uint32 channels);
+static void WriteAudioSpectrumFrames(const float *frames, ma_uint32 frameCount);
+static void UpdateAudioCallbackStats(double timeStart, ma_uint32 frameCount);
+static int GetAudioProcessorStatsIndex(AudioCallback process, bool claim);
+
+static void WriteAudioPlayhead(AudioPlayhead *playhead, ma_uint64 clock, ma_uint64 position, float rate);     // Publish playhead anchor (mixer)
+static void ReadAudioPlayhead(AudioPlayhead *playhead, ma_uint64 *clock, ma_uint64 *position, float *rate); // Read playhead anchor, lock-free
+static double GetAudioOutputClock(void);                    // Get audio clock frame being output by the device, interpolated
+static double GetMusicPlayheadPosition(Music music);        // Get music source frame being output by the device
 
 static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static void UpdateAudioQueueInLockedState(ma_uint64 clock, ma_uint32 frameCount);
+
+// Mixer commands queue, program threads never lock the mixer to change its state
+static ma_uint32 PushAudioCommand(AudioCommand command);     // Push command to the mixer queue, returns the command ticket
+static void PushAudioBufferRequest(AudioBuffer *buffer, AudioCommand command, bool playing, bool paused); // Push buffer state command, tracking requested state
+static bool IsAudioCommandPending(ma_uint32 ticket);         // Check if a command is still pending to be applied by the mixer
+static bool IsAudioBufferActive(AudioBuffer *buffer);        // Check if an audio buffer is playing or paused (not stopped), from a program state
+static void UnloadAudioBufferDeferred(AudioBuffer *buffer);  // Unload an audio buffer without waiting for the mixer, freed once untracked
+static void FreeAudioBufferGarbage(bool wait);               // Free unloaded audio buffers already untracked by the mixer
+static void SyncAudioCommands(ma_uint32 ticket);             // Wait for the mixer to process the commands up to ticket
+static void ProcessAudioCommands(void);                      // Process pending commands, requires mixer lock
+static void ApplyAudioCommand(const AudioCommand *command);  // Apply a command to the mixer state, requires mixer lock
+static void FreeAudioProcessorGarbage(void);                 // Free processors detached by the mixer
+
+static void ReadMusicStreamFrames(Music music, void *pcm, unsigned int frameCount);  // Read (decode) music stream frames
+static bool BuildMusicSeekIndex(Music music);                                       // Build music seek index (MP3), requires decoder lock
+static MusicDecoder *LoadMusicDecoder(Music music, unsigned int frames);            // Load music decoder and start its thread
+static void UnloadMusicDecoder(MusicDecoder *decoder);                              // Stop music decoder thread and unload it
+static MusicStretch *LoadMusicStretch(Music music);                                 // Load music time-stretch
+static void UnloadMusicStretch(MusicStretch *stretch);                              // Unload music time-stretch
+static void ResetMusicStretch(MusicStretch *stretch);                               // Reset music time-stretch, on music rewind or seek
+static ma_uint32 ReadMusicStretchFrames(MusicDecoder *decoder, float tempo, void *framesOut, ma_uint32 frameCount); // Read time-stretched music frames, requires decoder lock
+
+static void InitAudioVoices(void);                                                  // Init voices pool buffers
+static void UnloadAudioVoices(void);                                                // Unload voices pool buffers
+static void StopAudioVoices(AudioBuffer *source);                                   // Stop all voices playing a sound buffer
+static AudioVoice *GetAudioVoice(unsigned int instance);                            // Get voice playing a sound instance, requires voices lock
+static bool IsAudioVoiceBusy(AudioVoice *voice, ma_uint32 tail);                    // Check if a voice is playing, requires voices lock
+
+static void InitAudioBuses(void);                                                   // Init audio buses default state
+static void UnloadAudioBuses(void);                                                 // Unload audio buses effects and processors
+static float *GetAudioBusFrames(int bus, ma_uint32 frameCount);                     // Get bus mixing buffer for current chunk, requires mixer lock
+static AudioEffect *LoadAudioEffect(int type);                                      // Load bus effect with default parameters
+static void UnloadAudioEffect(AudioEffect *effect);                                 // Unload bus effect
+static void UpdateAudioEffect(AudioEffect *effect);                                 // Update effect coefficients from parameters
+static void ApplyAudioEffect(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels); // Apply effect to bus frames
+static void ApplyAudioBiquad(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels);     // Apply biquad filter
+static void ApplyAudioCompressor(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels); // Apply compressor or limiter
+static void ApplyAudioReverb(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels);     // Apply reverb
+
+static void InitAudioFFTTables(float *window, float *twiddleRe, float *twiddleIm, int *bitReverse); // Init FFT tables (AUDIO_ANALYSIS_FFT_SIZE)
+static void ComputeAudioFFT(float *re, float *im, const float *twiddleRe, const float *twiddleIm, const int *bitReverse); // Compute in-place FFT (AUDIO_ANALYSIS_FFT_SIZE)
+static void ComputeWaveFlux(WaveFluxTask *task);                                    // Compute spectral flux for a range of analysis windows
+#if !defined(__EMSCRIPTEN__)
+static ma_thread_result MA_THREADCALL WaveFluxThread(void *userData);               // Wave spectral flux thread, processes a task range
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -450,16 +914,22 @@ static bool SaveFileText(const char *fileName, char *text);         // Save text
 // NOTE: Those functions are not exposed by raylib... for the moment
 //----------------------------------------------------------------------------------
 AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage);
+AudioBuffer *LoadAudioBufferUntracked(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage);
 void UnloadAudioBuffer(AudioBuffer *buffer);
 
 bool IsAudioBufferPlaying(AudioBuffer *buffer);
 void PlayAudioBuffer(AudioBuffer *buffer);
+void PlayAudioBufferScheduled(AudioBuffer *buffer, ma_uint64 frame);
 void StopAudioBuffer(AudioBuffer *buffer);
+void StopAudioBufferScheduled(AudioBuffer *buffer, ma_uint64 frame);
 void PauseAudioBuffer(AudioBuffer *buffer);
 void ResumeAudioBuffer(AudioBuffer *buffer);
+void SeekAudioBuffer(AudioBuffer *buffer, ma_uint32 frame);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
+void SetAudioBufferVolumeScheduled(AudioBuffer *buffer, float volume, ma_uint64 frame, ma_uint32 rampFrames);
+void SetAudioBufferPanScheduled(AudioBuffer *buffer, float pan, ma_uint64 frame, ma_uint32 rampFrames);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -470,6 +940,50 @@ void UntrackAudioBuffer(AudioBuffer *buffer);
 // Initialize audio device
 void InitAudioDevice(void)
 {
+    AudioDeviceConfig config = { 0 };
+    config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.periodFrames = 0;    // Backend default
+    config.periodCount = 0;     // Backend default
+    config.performanceProfile = AUDIO_PROFILE_LOW_LATENCY;
+    config.shareMode = AUDIO_SHARE_MODE_SHARED;
+
+    InitAudioDeviceEx(config);
+}
+
+// Initialize audio device with custom configuration
+// NOTE: Requested values are just a hint, backend could negotiate different ones, use GetAudioOutputLatency() to check them
+void InitAudioDeviceEx(AudioDeviceConfig deviceConfig)
+{
+    // Audio clock starts with the device
+    ma_atomic_store_64(&AUDIO.System.framesRendered, 0);
+
+    InitAudioFFTTables(AUDIO.Spectrum.window, AUDIO.Spectrum.twiddleRe, AUDIO.Spectrum.twiddleIm, AUDIO.Spectrum.bitReverse);
+
+    if (deviceConfig.offline)
+    {
+        // Offline mode, no context or device required, mixer is driven by RenderAudioFrames()
+        if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
+            return;
+        }
+
+        AUDIO.System.sampleRate = (deviceConfig.sampleRate > 0)? deviceConfig.sampleRate : 48000;
+        AUDIO.System.channels = AUDIO_DEVICE_CHANNELS;
+        AUDIO.System.periodSize = (deviceConfig.periodFrames > 0)? deviceConfig.periodFrames : AUDIO.System.sampleRate/100;
+        AUDIO.System.isOffline = true;
+
+        TRACELOG(LOG_INFO, "AUDIO: Offline device initialized successfully");
+        TRACELOG(LOG_INFO, "    > Channels:      %d", AUDIO.System.channels);
+        TRACELOG(LOG_INFO, "    > Sample rate:   %d", AUDIO.System.sampleRate);
+
+        InitAudioVoices();
+        InitAudioBuses();
+
+        AUDIO.System.isReady = true;
+        return;
+    }
+
     // Init audio context
     ma_context_config ctxConfig = ma_context_config_init();
     ma_log_callback_init(OnLog, NULL);
@@ -498,9 +1012,15 @@ void InitAudioDevice(void)
     config.capture.pDeviceID = NULL;  // NULL for the default capture AUDIO.System.device
     config.capture.format = ma_format_s16;
     config.capture.channels = 1;
-    config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.playback.shareMode = (deviceConfig.shareMode == AUDIO_SHARE_MODE_EXCLUSIVE)? ma_share_mode_exclusive : ma_share_mode_shared;
+    config.sampleRate = deviceConfig.sampleRate;
+    config.periodSizeInFrames = deviceConfig.periodFrames;
+    config.periods = deviceConfig.periodCount;
+    config.performanceProfile = (deviceConfig.performanceProfile == AUDIO_PROFILE_CONSERVATIVE)? ma_performance_profile_conservative : ma_performance_profile_low_latency;
     config.dataCallback = OnSendAudioDataToDevice;
     config.pUserData = NULL;
+    config.noPreSilencedOutputBuffer = true;    // Output buffer is cleared by the mixer
+    config.noClip = true;                       // Master volume and clipping are applied by the mixer
 
     result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
     if (result != MA_SUCCESS)
@@ -510,8 +1030,13 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixer output parameters, required before starting the device
+    AUDIO.System.sampleRate = AUDIO.System.device.sampleRate;
+    AUDIO.System.channels = AUDIO.System.device.playback.channels;
+    AUDIO.System.periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+
+    // Mixing happens on a separate thread, mixer state is only modified through the commands queue, so the
+    // mixer never waits on program threads, this mutex only protects pcmBuffer and it is never locked by the mixer
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -520,6 +1045,11 @@ void InitAudioDevice(void)
         return;
     }
 
+    // Voices and buses must be ready before the mixer starts
+    InitAudioVoices();
+    InitAudioBuses();
+    ma_timer_init(&AUDIO.System.timer);
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
     result = ma_device_start(&AUDIO.System.device);
@@ -528,6 +1058,7 @@ void InitAudioDevice(void)
         TRACELOG(LOG_WARNING, "AUDIO: Failed to start playback device");
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
+        UnloadAudioVoices();
         return;
     }
 
@@ -539,6 +1070,8 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
     AUDIO.System.isReady = true;
+
+    TRACELOG(LOG_INFO, "    > Latency:       %d frames (%.2f ms)", GetAudioOutputLatencyFrames(), GetAudioOutputLatency());
 }
 
 // Close the audio device for all contexts
@@ -546,11 +1079,22 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
+        // Unloaded sounds are freed while the mixer is still running
+        FreeAudioBufferGarbage(true);
+
         ma_mutex_uninit(&AUDIO.System.lock);
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
+
+        if (!AUDIO.System.isOffline)
+        {
+            ma_device_uninit(&AUDIO.System.device);
+            ma_context_uninit(&AUDIO.System.context);
+        }
+
+        UnloadAudioVoices();
+        UnloadAudioBuses();
 
         AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -569,23 +1113,264 @@ bool IsAudioDeviceReady(void)
 // Set master volume (listener)
 void SetMasterVolume(float volume)
 {
-    ma_device_set_master_volume(&AUDIO.System.device, volume);
+    ma_atomic_exchange_f32(&AUDIO.System.masterVolume, volume);
 }
 
 // Get master volume (listener)
 float GetMasterVolume(void)
 {
-    float volume = 0.0f;
-    ma_device_get_master_volume(&AUDIO.System.device, &volume);
+    float volume = ma_atomic_load_f32(&AUDIO.System.masterVolume);
     return volume;
 }
 
+// Get audio clock, total frames rendered by the mixer
+// NOTE: Clock is updated once per device period, scheduled events should be set some periods ahead
+unsigned long long GetAudioClockFrames(void)
+{
+    return (unsigned long long)ma_atomic_load_64(&AUDIO.System.framesRendered);
+}
+
+// Get audio clock sample rate (device sample rate)
+unsigned int GetAudioClockSampleRate(void)
+{
+    return AUDIO.System.sampleRate;
+}
+
+// Get audio output latency in frames (at device sample rate)
+// NOTE: Latency is the negotiated device buffering, driver and hardware latency is not considered
+int GetAudioOutputLatencyFrames(void)
+{
+    int latency = 0;
+
+    if (AUDIO.System.isReady && !AUDIO.System.isOffline && (AUDIO.System.device.playback.internalSampleRate > 0))
+    {
+        ma_uint64 internalFrames = (ma_uint64)AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods;
+
+        // Device internal buffering could use a different sample rate, it is converted to device sample rate
+        latency = (int)(internalFrames*AUDIO.System.sampleRate/AUDIO.System.device.playback.internalSampleRate);
+    }
+
+    return latency;
+}
+
+// Get audio output latency in milliseconds
+float GetAudioOutputLatency(void)
+{
+    float latency = 0.0f;
+
+    if (AUDIO.System.isReady && (AUDIO.System.sampleRate > 0)) latency = (float)GetAudioOutputLatencyFrames()*1000.0f/(float)AUDIO.System.sampleRate;
+
+    return latency;
+}
+
+// Get mixed output spectrum in logarithmic frequency bands, levels in [0.0f..1.0f] range
+// NOTE: Tap is enabled on first call, mixer only copies mixed frames to a ring, FFT is computed here
+// on the calling thread; bands keep previous values, blended with new ones by smoothing [0.0f..1.0f]
+void GetAudioSpectrum(float *bands, int count, float smoothing)
+{
+    if ((bands == NULL) || (count <= 0)) return;
+
+    if (!AUDIO.System.isReady)
+    {
+        for (int i = 0; i < count; i++) bands[i] = 0.0f;
+        return;
+    }
+
+    ma_atomic_store_32(&AUDIO.Spectrum.enabled, true);
+
+    if (smoothing < 0.0f) smoothing = 0.0f;
+    if (smoothing > 1.0f) smoothing = 1.0f;
+
+    float re[AUDIO_ANALYSIS_FFT_SIZE] = { 0 };
+    float im[AUDIO_ANALYSIS_FFT_SIZE] = { 0 };
+
+    // Copy latest frames from ring (downmixed to mono), copy is discarded
+    // and retried if the mixer overwrote the frames while reading them
+    for (int retry = 0; retry < 4; retry++)
+    {
+        ma_uint32 position = ma_atomic_load_explicit_32(&AUDIO.Spectrum.framesWritten, ma_atomic_memory_order_acquire);
+
+        for (int i = 0; i < AUDIO_ANALYSIS_FFT_SIZE; i++)
+        {
+            const float *frame = AUDIO.Spectrum.ring + ((position - AUDIO_ANALYSIS_FFT_SIZE + i) & (AUDIO_SPECTRUM_RING_FRAMES - 1))*AUDIO_DEVICE_CHANNELS;
+
+            float sum = 0.0f;
+            for (int c = 0; c < AUDIO_DEVICE_CHANNELS; c++) sum += frame[c];
+            re[i] = sum/AUDIO_DEVICE_CHANNELS*AUDIO.Spectrum.window[i];
+        }
+
+        ma_uint32 written = ma_atomic_load_explicit_32(&AUDIO.Spectrum.framesWritten, ma_atomic_memory_order_acquire) - position;
+        if (written <= (AUDIO_SPECTRUM_RING_FRAMES - AUDIO_ANALYSIS_FFT_SIZE)) break;
+    }
+
+    ComputeAudioFFT(re, im, AUDIO.Spectrum.twiddleRe, AUDIO.Spectrum.twiddleIm, AUDIO.Spectrum.bitReverse);
+
+    // Bands are spaced logarithmically from first bin (DC excluded) to Nyquist frequency,
+    // every band covers at least one bin, band level is the peak bin magnitude (in decibels)
+    const int bins = AUDIO_ANALYSIS_FFT_SIZE/2;
+    int binStart = 1;
+
+    for (int i = 0; i < count; i++)
+    {
+        int binEnd = (int)(powf((float)bins, (float)(i + 1)/(float)count) + 0.5f);
+        if (binEnd <= binStart) binEnd = binStart + 1;
+        if (binEnd > bins + 1) binEnd = bins + 1;
+
+        float peak = 0.0f;
+
+        for (int k = binStart; k < binEnd; k++)
+        {
+            float magnitude = re[k]*re[k] + im[k]*im[k];
+            if (magnitude > peak) peak = magnitude;
+        }
+
+        // Magnitude normalized to sine amplitude (Hann window coherent gain is 0.5)
+        float amplitude = sqrtf(peak)*4.0f/AUDIO_ANALYSIS_FFT_SIZE;
+        float level = (amplitude > 0.0f)? 1.0f - 20.0f*log10f(amplitude)/AUDIO_SPECTRUM_MIN_DB : 0.0f;
+        if (level < 0.0f) level = 0.0f;
+        if (level > 1.0f) level = 1.0f;
+
+        bands[i] = bands[i]*smoothing + level*(1.0f - smoothing);
+
+        if (binEnd <= bins) binStart = binEnd;
+    }
+}
+
+// Get audio stats: sounds memory, mixed frames by path, compressed sounds decoding and mixer callbacks timing
+// NOTE: All counters are lock-free, they are updated by the mixer while the stats are read
+AudioStats GetAudioStats(void)
+{
+    AudioStats stats = { 0 };
+
+    stats.soundCount = ma_atomic_load_32(&AUDIO.Stats.soundCount);
+    stats.soundMemory = ma_atomic_load_64(&AUDIO.Stats.soundMemory);
+    stats.framesDirect = ma_atomic_load_64(&AUDIO.Stats.framesDirect);
+    stats.framesConverted = ma_atomic_load_64(&AUDIO.Stats.framesConverted);
+    stats.compressedCount = ma_atomic_load_32(&AUDIO.Stats.compressedCount);
+    stats.compressedMemory = ma_atomic_load_64(&AUDIO.Stats.compressedMemory);
+    stats.compressedSaved = ma_atomic_load_64(&AUDIO.Stats.compressedSaved);
+    stats.framesDecoded = ma_atomic_load_64(&AUDIO.Stats.framesDecoded);
+    stats.decodeTime = (double)ma_atomic_load_64(&AUDIO.Stats.decodeTime)/1000000000.0;
+
+    stats.callbackCount = ma_atomic_load_64(&AUDIO.Stats.callbackCount);
+
+    if (stats.callbackCount > 0)
+    {
+        double callbackTime = (double)ma_atomic_load_64(&AUDIO.Stats.callbackTime)/1000000000.0;
+        double callbackPeriods = (double)ma_atomic_load_64(&AUDIO.Stats.callbackFrames)/(double)AUDIO.System.sampleRate;
+
+        stats.callbackTimeAvg = (float)(callbackTime/(double)stats.callbackCount);
+        stats.callbackTimeMax = (float)((double)ma_atomic_load_64(&AUDIO.Stats.callbackTimeMax)/1000000000.0);
+        if (callbackPeriods > 0.0) stats.callbackLoad = (float)(callbackTime/callbackPeriods);
+        stats.callbackLoadMax = (float)ma_atomic_load_32(&AUDIO.Stats.callbackLoadMax)/1000000.0f;
+        stats.processorTime = (float)((double)ma_atomic_load_64(&AUDIO.Stats.processorTime)/1000000000.0/(double)stats.callbackCount);
+
+        // Percentiles are read from the durations histogram, reported as their bin upper bound
+        ma_uint32 histogram[AUDIO_STATS_HISTOGRAM_BINS] = { 0 };
+        ma_uint64 histogramCount = 0;
+
+        for (int i = 0; i < AUDIO_STATS_HISTOGRAM_BINS; i++)
+        {
+            histogram[i] = ma_atomic_load_32(&AUDIO.Stats.callbackHistogram[i]);
+            histogramCount += histogram[i];
+        }
+
+        ma_uint64 count = 0;
+
+        for (int i = 0; i < AUDIO_STATS_HISTOGRAM_BINS; i++)
+        {
+            count += histogram[i];
+
+            // Bin upper bound: 2^((bin + 1)/4) - 1 microseconds
+            float binTime = (powf(2.0f, (float)(i + 1)/4.0f) - 1.0f)/1000000.0f;
+
+            if ((stats.callbackTimeP95 == 0.0f) && (count*100 >= histogramCount*95)) stats.callbackTimeP95 = binTime;
+            if ((stats.callbackTimeP99 == 0.0f) && (count*100 >= histogramCount*99)) stats.callbackTimeP99 = binTime;
+        }
+
+        // Bins are coarse, percentiles are never reported over the measured maximum
+        if (stats.callbackTimeP95 > stats.callbackTimeMax) stats.callbackTimeP95 = stats.callbackTimeMax;
+        if (stats.callbackTimeP99 > stats.callbackTimeMax) stats.callbackTimeP99 = stats.callbackTimeMax;
+    }
+
+    stats.activeVoices = ma_atomic_load_32(&AUDIO.Stats.activeVoices);
+    stats.activeResamplers = ma_atomic_load_32(&AUDIO.Stats.activeResamplers);
+    stats.deadlineMisses = ma_atomic_load_32(&AUDIO.Stats.deadlineMisses);
+    stats.xruns = ma_atomic_load_32(&AUDIO.Stats.xruns);
+    stats.streamUnderruns = ma_atomic_load_32(&AUDIO.Stats.streamUnderruns);
+
+    return stats;
+}
+
+// Reset audio stats counters: mixed frames, decoding, callbacks timing and underruns
+// NOTE: Loaded sounds count and memory are kept, counters are reset one by one while the mixer runs
+void ResetAudioStats(void)
+{
+    ma_atomic_store_64(&AUDIO.Stats.framesDirect, 0);
+    ma_atomic_store_64(&AUDIO.Stats.framesConverted, 0);
+    ma_atomic_store_64(&AUDIO.Stats.framesDecoded, 0);
+    ma_atomic_store_64(&AUDIO.Stats.decodeTime, 0);
+    ma_atomic_store_64(&AUDIO.Stats.callbackCount, 0);
+    ma_atomic_store_64(&AUDIO.Stats.callbackFrames, 0);
+    ma_atomic_store_64(&AUDIO.Stats.callbackTime, 0);
+    ma_atomic_store_64(&AUDIO.Stats.callbackTimeMax, 0);
+    ma_atomic_store_32(&AUDIO.Stats.callbackLoadMax, 0);
+    for (int i = 0; i < AUDIO_STATS_HISTOGRAM_BINS; i++) ma_atomic_store_32(&AUDIO.Stats.callbackHistogram[i], 0);
+    ma_atomic_store_64(&AUDIO.Stats.processorTime, 0);
+    for (int i = 0; i < AUDIO_STATS_MAX_PROCESSORS; i++) ma_atomic_store_64(&AUDIO.Stats.processors[i].time, 0);
+    ma_atomic_store_32(&AUDIO.Stats.deadlineMisses, 0);
+    ma_atomic_store_32(&AUDIO.Stats.xruns, 0);
+    ma_atomic_store_32(&AUDIO.Stats.streamUnderruns, 0);
+}
+
+// Render audio frames in offline mode, running the full mixing pipeline
+// NOTE: Output frames are interleaved float samples (AUDIO_DEVICE_CHANNELS) at mixer sample rate,
+// they can be exported to a file using a 32bit Wave: { frameCount, sampleRate, 32, channels, frames }
+void RenderAudioFrames(float *frames, int frameCount)
+{
+    if (!AUDIO.System.isReady || !AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Audio frames can only be rendered in offline mode");
+        return;
+    }
+
+    if ((frames == NULL) || (frameCount <= 0)) return;
+
+    memset(frames, 0, frameCount*AUDIO.System.channels*sizeof(float));
+
+    // Mixer is rendered by periods, like a real device does, to keep scheduled events granularity
+    for (int framesRendered = 0; framesRendered < frameCount; framesRendered += AUDIO.System.periodSize)
+    {
+        ma_uint32 framesToRender = AUDIO.System.periodSize;
+        if ((ma_uint32)(frameCount - framesRendered) < framesToRender) framesToRender = frameCount - framesRendered;
+
+        ma_spinlock_lock(&AUDIO.System.mixLock);
+        MixAudioOutputInLockedState(frames + framesRendered*AUDIO.System.channels, framesToRender);
+        ma_spinlock_unlock(&AUDIO.System.mixLock);
+    }
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
 
 // Initialize a new audio buffer (filled with silence)
 AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage)
+{
+    // Sounds unloaded before are freed, if the mixer already untracked them
+    FreeAudioBufferGarbage(false);
+
+    AudioBuffer *audioBuffer = LoadAudioBufferUntracked(format, channels, sampleRate, sizeInFrames, usage);
+
+    // Track audio buffer to linked list next position
+    if (audioBuffer != NULL) TrackAudioBuffer(audioBuffer);
+
+    return audioBuffer;
+}
+
+// Initialize a new audio buffer (filled with silence), not added to the mixer list
+// NOTE: Used for voices pool buffers, mixed from the active voices array
+AudioBuffer *LoadAudioBufferUntracked(ma_format format, ma_uint32 channels, ma_uint32 sampleRate, ma_uint32 sizeInFrames, int usage)
 {
     AudioBuffer *audioBuffer = (AudioBuffer *)RL_CALLOC(1, sizeof(AudioBuffer));
 
@@ -597,8 +1382,9 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 
     if (sizeInFrames > 0) audioBuffer->data = RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
 
-    // Audio data runs through a format converter
-    ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
+    // Audio data runs through a format converter, signed 16 bit data is converted to float on reading
+    ma_format converterFormat = (format == ma_format_s16)? ma_format_f32 : format;
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(converterFormat, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.sampleRate);
     converterConfig.allowDynamicSampleRate = true;
 
     ma_result result = ma_data_converter_init(&converterConfig, NULL, &audioBuffer->converter);
@@ -611,9 +1397,16 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     }
 
     // Init audio buffer values
+    audioBuffer->format = format;
     audioBuffer->volume = 1.0f;
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.5f;
+    audioBuffer->fade = 1.0f;
+    audioBuffer->tempo = 1.0f;
+    UpdateAudioBufferLevels(audioBuffer);
+
+    audioBuffer->startFrame = 0;
+    audioBuffer->stopFrame = AUDIO_CLOCK_NEVER;
 
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
@@ -623,6 +1416,7 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->looping = false;
 
     audioBuffer->usage = usage;
+    audioBuffer->bus = AUDIO_BUS_SFX;
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
 
@@ -631,9 +1425,6 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->isSubBufferProcessed[0] = true;
     audioBuffer->isSubBufferProcessed[1] = true;
 
-    // Track audio buffer to linked list next position
-    TrackAudioBuffer(audioBuffer);
-
     return audioBuffer;
 }
 
@@ -644,18 +1435,31 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
     {
         UntrackAudioBuffer(buffer);
         ma_data_converter_uninit(&buffer->converter, NULL);
+
+        if (buffer->ring != NULL)
+        {
+            ma_pcm_rb_uninit(buffer->ring);
+            RL_FREE(buffer->ring);
+        }
+
         RL_FREE(buffer->data);
+        RL_FREE(buffer->cursor);
         RL_FREE(buffer);
     }
 }
 
 // Check if an audio buffer is playing from a program state without lock
+// NOTE: State requested by the program is reported until the mixer applies it, mixer state after that
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        if (IsAudioCommandPending(ma_atomic_load_32(&buffer->requestTicket))) result = (ma_atomic_load_32(&buffer->requestPlaying) && !ma_atomic_load_32(&buffer->requestPaused));
+        else result = (ma_atomic_load_32(&buffer->playing) && !ma_atomic_load_32(&buffer->paused));
+    }
+
     return result;
 }
 
@@ -666,20 +1470,44 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        // Requested state is immediately reported by IsAudioBufferPlaying(), mixer state is set by the mixer
+        AudioCommand command = { .type = AUDIO_COMMAND_PLAY, .buffer = buffer };
+        PushAudioBufferRequest(buffer, command, true, false);
+    }
+}
+
+// Play an audio buffer from the start at a scheduled audio clock frame
+// NOTE: Buffer is reported as playing while waiting for the scheduled frame,
+// if frame is already rendered, buffer starts playing on next mixer period
+void PlayAudioBufferScheduled(AudioBuffer *buffer, ma_uint64 frame)
+{
+    if (buffer != NULL)
+    {
+        // Mixer state is only set by the mixer, along with the start frame,
+        // otherwise buffer could be mixed before its scheduled frame
+        AudioCommand command = { .type = AUDIO_COMMAND_PLAY, .buffer = buffer, .frame = frame };
+        PushAudioBufferRequest(buffer, command, true, false);
     }
 }
 
 // Stop an audio buffer from a program state without lock
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL)
+    {
+        AudioCommand command = { .type = AUDIO_COMMAND_STOP, .buffer = buffer };
+        PushAudioBufferRequest(buffer, command, false, false);
+    }
+}
+
+// Stop an audio buffer at a scheduled audio clock frame
+void StopAudioBufferScheduled(AudioBuffer *buffer, ma_uint64 frame)
+{
+    if (buffer != NULL)
+    {
+        AudioCommand command = { .type = AUDIO_COMMAND_STOP_SCHEDULED, .buffer = buffer, .frame = frame };
+        PushAudioCommand(command);
+    }
 }
 
 // Pause an audio buffer
@@ -687,9 +1515,8 @@ void PauseAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_PAUSE, .buffer = buffer };
+        PushAudioBufferRequest(buffer, command, IsAudioBufferActive(buffer), true);
     }
 }
 
@@ -698,9 +1525,19 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_RESUME, .buffer = buffer };
+        PushAudioBufferRequest(buffer, command, IsAudioBufferActive(buffer), false);
+    }
+}
+
+// Seek an audio buffer to a frame, static buffers only (sounds)
+// NOTE: Frame must be in buffer range, checked by the caller
+void SeekAudioBuffer(AudioBuffer *buffer, ma_uint32 frame)
+{
+    if (buffer != NULL)
+    {
+        AudioCommand command = { .type = AUDIO_COMMAND_SEEK, .buffer = buffer, .frames = frame };
+        PushAudioCommand(command);
     }
 }
 
@@ -709,9 +1546,8 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume };
+        PushAudioCommand(command);
     }
 }
 
@@ -720,16 +1556,8 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch };
+        PushAudioCommand(command);
     }
 }
 
@@ -741,44 +1569,73 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
 
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan };
+        PushAudioCommand(command);
     }
 }
 
-// Track audio buffer to linked list next position
-void TrackAudioBuffer(AudioBuffer *buffer)
+// Set volume for an audio buffer at a scheduled audio clock frame, ramping it linearly for rampFrames
+void SetAudioBufferVolumeScheduled(AudioBuffer *buffer, float volume, ma_uint64 frame, ma_uint32 rampFrames)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (buffer != NULL)
     {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
+        AudioCommand command = { .type = AUDIO_COMMAND_VOLUME_RAMP, .buffer = buffer, .value = volume, .frame = frame, .frames = rampFrames };
+        PushAudioCommand(command);
+    }
+}
+
+// Set pan for an audio buffer at a scheduled audio clock frame, ramping it linearly for rampFrames
+void SetAudioBufferPanScheduled(AudioBuffer *buffer, float pan, ma_uint64 frame, ma_uint32 rampFrames)
+{
+    if (pan < 0.0f) pan = 0.0f;
+    else if (pan > 1.0f) pan = 1.0f;
 
-        AUDIO.Buffer.last = buffer;
+    if (buffer != NULL)
+    {
+        AudioCommand command = { .type = AUDIO_COMMAND_PAN_RAMP, .buffer = buffer, .value = pan, .frame = frame, .frames = rampFrames };
+        PushAudioCommand(command);
     }
-    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Track audio buffer to linked list next position
+// NOTE: Buffer is added to the list by the mixer, it must be fully initialized at this point
+void TrackAudioBuffer(AudioBuffer *buffer)
+{
+    AudioCommand command = { .type = AUDIO_COMMAND_TRACK, .buffer = buffer };
+    PushAudioCommand(command);
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Function waits for the mixer to remove the buffer, after that, buffer can be safely freed
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
+    AudioCommand command = { .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer };
+    SyncAudioCommands(PushAudioCommand(command));
+}
 
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
+// Unload an audio buffer without waiting for the mixer, it is freed once untracked
+// NOTE: Used for sounds, unloading many of them does not cost a mixer period each, buffer data and
+// compressed data are freed with the buffer unless it is an alias, see FreeAudioBufferGarbage()
+static void UnloadAudioBufferDeferred(AudioBuffer *buffer)
+{
+    if (buffer == NULL) return;
 
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    // Buffers unloaded before are freed first, if the mixer already untracked them
+    FreeAudioBufferGarbage(false);
+
+    AudioCommand command = { .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer };
+    buffer->unloadTicket = PushAudioCommand(command);
+
+    // Unloaded buffers list is shared by program threads, buffer is pushed with a compare-exchange loop
+    AudioBuffer *unloaded = NULL;
+    do
+    {
+        unloaded = (AudioBuffer *)ma_atomic_load_ptr((void **)&AUDIO.Buffer.unloaded);
+        buffer->unloadNext = unloaded;
+    } while (!ma_atomic_compare_exchange_weak_ptr((void **)&AUDIO.Buffer.unloaded, (void **)&unloaded, buffer));
+
+    // Mixer is not running anymore, nothing else would free the buffer
+    if (!AUDIO.System.isReady) FreeAudioBufferGarbage(true);
 }
 
 //----------------------------------------------------------------------------------
@@ -959,64 +1816,190 @@ Sound LoadSoundFromWave(Wave wave)
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
+        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
         if (audioBuffer == NULL)
         {
             TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
         sound.frameCount = frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
+        sound.stream.sampleRate = AUDIO.System.sampleRate;
         sound.stream.sampleSize = 32;
         sound.stream.channels = AUDIO_DEVICE_CHANNELS;
         sound.stream.buffer = audioBuffer;
+
+        ma_atomic_fetch_add_32(&AUDIO.Stats.soundCount, 1);
+        ma_atomic_fetch_add_64(&AUDIO.Stats.soundMemory, (ma_uint64)audioBuffer->sizeInFrames*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS));
     }
 
     return sound;
 }
 
-// Clone sound from existing sound data, clone does not own wave data
-// NOTE: Wave data must be unallocated manually and will be shared across all clones
-Sound LoadSoundAlias(Sound source)
+// Load sound from file, keeping it compressed in memory (QOA), decoded on demand while playing
+// NOTE: Other formats (or QOA files not matching device sample rate and channels) are encoded to QOA on loading,
+// memory is reduced around 8 times compared to a sound loaded with LoadSound()
+Sound LoadSoundCompressed(const char *fileName)
 {
     Sound sound = { 0 };
 
-    if (source.stream.buffer->data != NULL)
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    qoa_desc qoa = { 0 };
+    unsigned char *data = NULL;
+    unsigned int dataSize = 0;
+
+    if (IsFileExtension(fileName, ".qoa"))
     {
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        int fileSize = 0;
+        data = LoadFileData(fileName, &fileSize);
+        dataSize = (unsigned int)fileSize;
 
-        if (audioBuffer == NULL)
+        if ((data != NULL) && ((qoa_decode_header(data, fileSize, &qoa) == 0) ||
+            (qoa.channels != AUDIO_DEVICE_CHANNELS) || (qoa.samplerate != AUDIO.System.sampleRate)))
         {
-            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
-            return sound; // Early return to avoid dereferencing the audioBuffer null pointer
+            UnloadFileData(data);
+            data = NULL;
         }
-
-        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
-        audioBuffer->volume = source.stream.buffer->volume;
-        audioBuffer->data = source.stream.buffer->data;
-
-        sound.frameCount = source.frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
-        sound.stream.buffer = audioBuffer;
     }
 
-    return sound;
-}
+    if (data == NULL)
+    {
+        // Sound is encoded in device format, so decoded frames never require conversion
+        Wave wave = LoadWave(fileName);
 
+        if (wave.data != NULL)
+        {
+            WaveFormat(&wave, AUDIO.System.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
+
+            qoa.channels = wave.channels;
+            qoa.samplerate = wave.sampleRate;
+            qoa.samples = wave.frameCount;
+
+            data = (unsigned char *)qoa_encode((const short *)wave.data, &qoa, &dataSize);
+            UnloadWave(wave);
+        }
+    }
+
+    if (data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: [%s] Failed to load compressed sound", fileName);
+        return sound;
+    }
+
+    // Frames are validated once, so they can be decoded without checks while playing
+    unsigned int qoaFrames = (qoa.samples + QOA_FRAME_LEN - 1)/QOA_FRAME_LEN;
+    bool valid = true;
+
+    for (unsigned int i = 0; (i < qoaFrames) && valid; i++)
+    {
+        unsigned int samples = ((i + 1) < qoaFrames)? QOA_FRAME_LEN : qoa.samples - i*QOA_FRAME_LEN;
+        unsigned int slices = (samples + QOA_SLICE_LEN - 1)/QOA_SLICE_LEN;
+        unsigned int frameSize = QOA_FRAME_SIZE(qoa.channels, slices);
+        unsigned int offset = 8 + i*QOA_FRAME_SIZE(qoa.channels, QOA_SLICES_PER_FRAME);
+
+        if ((offset + frameSize) > dataSize) valid = false;
+        else
+        {
+            unsigned int p = offset;
+            qoa_uint64_t header = qoa_read_u64(data, &p);
+
+            valid = ((((header >> 56) & 0xff) == qoa.channels) && (((header >> 32) & 0xffffff) == qoa.samplerate) &&
+                     (((header >> 16) & 0xffff) == samples) && ((header & 0xffff) == frameSize));
+        }
+    }
+
+    AudioCompressed *compressed = valid? (AudioCompressed *)RL_CALLOC(1, sizeof(AudioCompressed)) : NULL;
+    AudioBuffer *audioBuffer = (compressed != NULL)? LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC) : NULL;
+    AudioCompressedCursor *cursor = (audioBuffer != NULL)? (AudioCompressedCursor *)RL_CALLOC(1, sizeof(AudioCompressedCursor)) : NULL;
+
+    if (cursor == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: [%s] Failed to create compressed sound", fileName);
+        UnloadAudioBuffer(audioBuffer);
+        RL_FREE(compressed);
+        RL_FREE(data);
+        return sound;
+    }
+
+    compressed->data = data;
+    compressed->dataSize = dataSize;
+    compressed->frameCount = qoa.samples;
+    compressed->channels = qoa.channels;
+
+    audioBuffer->compressed = compressed;
+    audioBuffer->cursor = cursor;
+    audioBuffer->sizeInFrames = compressed->frameCount;
+
+    sound.frameCount = compressed->frameCount;
+    sound.stream.sampleRate = AUDIO.System.sampleRate;
+    sound.stream.sampleSize = 32;
+    sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+    sound.stream.buffer = audioBuffer;
+
+    ma_uint64 decodedSize = (ma_uint64)compressed->frameCount*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS);
+
+    ma_atomic_fetch_add_32(&AUDIO.Stats.soundCount, 1);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.soundMemory, dataSize);
+    ma_atomic_fetch_add_32(&AUDIO.Stats.compressedCount, 1);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.compressedMemory, dataSize);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.compressedSaved, (decodedSize > dataSize)? decodedSize - dataSize : 0);
+
+    TRACELOG(LOG_INFO, "SOUND: [%s] Compressed sound loaded (%i frames, %i bytes)", fileName, compressed->frameCount, dataSize);
+#else
+    TRACELOG(LOG_WARNING, "SOUND: [%s] Compressed sounds require QOA format support", fileName);
+#endif
+
+    return sound;
+}
+
+// Clone sound from existing sound data, clone does not own wave data
+// NOTE: Wave data must be unallocated manually and will be shared across all clones
+Sound LoadSoundAlias(Sound source)
+{
+    Sound sound = { 0 };
+
+    if ((source.stream.buffer->data != NULL) || (source.stream.buffer->compressed != NULL))
+    {
+        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+        if (audioBuffer == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+            return sound; // Early return to avoid dereferencing the audioBuffer null pointer
+        }
+
+        audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
+        audioBuffer->volume = source.stream.buffer->volume;
+        audioBuffer->data = source.stream.buffer->data;
+        audioBuffer->compressed = source.stream.buffer->compressed;
+        audioBuffer->isAlias = true;
+
+        // Compressed data is shared but every alias keeps its own decoding cursor
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (audioBuffer->compressed != NULL) audioBuffer->cursor = (AudioCompressedCursor *)RL_CALLOC(1, sizeof(AudioCompressedCursor));
+#endif
+
+        sound.frameCount = source.frameCount;
+        sound.stream.sampleRate = AUDIO.System.sampleRate;
+        sound.stream.sampleSize = 32;
+        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        sound.stream.buffer = audioBuffer;
+    }
+
+    return sound;
+}
 
-// Checks if a sound is valid (data loaded and buffers initialized)
-bool IsSoundValid(Sound sound)
-{
-    bool result = false;
+
+// Checks if a sound is valid (data loaded and buffers initialized)
+bool IsSoundValid(Sound sound)
+{
+    bool result = false;
 
     if ((sound.frameCount > 0) &&           // Validate frame count
         (sound.stream.buffer != NULL) &&    // Validate stream buffer
@@ -1037,7 +2020,34 @@ void UnloadWave(Wave wave)
 // Unload sound
 void UnloadSound(Sound sound)
 {
-    UnloadAudioBuffer(sound.stream.buffer);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    AudioCompressed *compressed = (sound.stream.buffer != NULL)? sound.stream.buffer->compressed : NULL;
+#endif
+
+    if (sound.stream.buffer != NULL)
+    {
+        ma_atomic_fetch_sub_32(&AUDIO.Stats.soundCount, 1);
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (compressed != NULL)
+        {
+            ma_uint64 decodedSize = (ma_uint64)compressed->frameCount*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS);
+
+            ma_atomic_fetch_sub_64(&AUDIO.Stats.soundMemory, compressed->dataSize);
+            ma_atomic_fetch_sub_32(&AUDIO.Stats.compressedCount, 1);
+            ma_atomic_fetch_sub_64(&AUDIO.Stats.compressedMemory, compressed->dataSize);
+            ma_atomic_fetch_sub_64(&AUDIO.Stats.compressedSaved, (decodedSize > compressed->dataSize)? decodedSize - compressed->dataSize : 0);
+        }
+        else
+#endif
+        ma_atomic_fetch_sub_64(&AUDIO.Stats.soundMemory, (ma_uint64)sound.stream.buffer->sizeInFrames*ma_get_bytes_per_frame(sound.stream.buffer->format, sound.stream.buffer->converter.channelsIn));
+    }
+
+    // Voices playing the sound share its data, they are stopped before the sound is untracked,
+    // sound data (and compressed data, shared with its aliases) is freed once the mixer untracks it
+    StopAudioVoices(sound.stream.buffer);
+    UnloadAudioBufferDeferred(sound.stream.buffer);
+
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
 
@@ -1046,9 +2056,8 @@ void UnloadSoundAlias(Sound alias)
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
     if (alias.stream.buffer != NULL)
     {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
+        StopAudioVoices(alias.stream.buffer);
+        UnloadAudioBufferDeferred(alias.stream.buffer);
     }
 }
 
@@ -1059,7 +2068,10 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
     {
         StopAudioBuffer(sound.stream.buffer);
 
-        memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
+        // Make sure mixer is not reading buffer data before updating it
+        SyncAudioCommands(ma_atomic_load_32(&AUDIO.Command.head));
+
+        memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->format, sound.stream.buffer->converter.channelsIn));
     }
 }
 
@@ -1206,12 +2218,39 @@ void ResumeSound(Sound sound)
     ResumeAudioBuffer(sound.stream.buffer);
 }
 
+// Seek a sound to a position (in seconds), sound keeps playing from there
+// NOTE: Sound is restarted from the start by PlaySound(), so seek after playing it
+void SeekSound(Sound sound, float position)
+{
+    unsigned int frame = (position > 0.0f)? (unsigned int)(position*sound.stream.sampleRate) : 0;
+
+    if (frame >= sound.frameCount)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Seek position out of sound range: %.3f seconds", position);
+        return;
+    }
+
+    SeekAudioBuffer(sound.stream.buffer, frame);
+}
+
 // Stop reproducing a sound
 void StopSound(Sound sound)
 {
     StopAudioBuffer(sound.stream.buffer);
 }
 
+// Play a sound at a scheduled audio clock frame, see GetAudioClockFrames()
+void PlaySoundScheduled(Sound sound, unsigned long long frame)
+{
+    PlayAudioBufferScheduled(sound.stream.buffer, frame);
+}
+
+// Stop a sound at a scheduled audio clock frame
+void StopSoundScheduled(Sound sound, unsigned long long frame)
+{
+    StopAudioBufferScheduled(sound.stream.buffer, frame);
+}
+
 // Check if a sound is playing
 bool IsSoundPlaying(Sound sound)
 {
@@ -1240,6 +2279,203 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Set volume for a sound at a scheduled audio clock frame, ramping for rampFrames (0 for an immediate change)
+void SetSoundVolumeScheduled(Sound sound, float volume, unsigned long long frame, unsigned int rampFrames)
+{
+    SetAudioBufferVolumeScheduled(sound.stream.buffer, volume, frame, rampFrames);
+}
+
+// Set pan for a sound at a scheduled audio clock frame, ramping for rampFrames (0 for an immediate change)
+void SetSoundPanScheduled(Sound sound, float pan, unsigned long long frame, unsigned int rampFrames)
+{
+    SetAudioBufferPanScheduled(sound.stream.buffer, pan, frame, rampFrames);
+}
+
+// Play a sound instance on a voice from the voices pool, returns instance id (0 if no voice available)
+// NOTE: If no voice is free or sound max instances are playing, a voice with same or lower priority is
+// stolen (oldest or quietest one, depending on stealing mode), instance starts with sound volume, pitch and pan
+unsigned int PlaySoundInstance(Sound sound, int priority)
+{
+    unsigned int instance = 0;
+
+    if (!AUDIO.System.isReady || !IsSoundValid(sound) || ((sound.stream.buffer->data == NULL) && (sound.stream.buffer->compressed == NULL))) return instance;
+
+    AudioBuffer *source = sound.stream.buffer;
+
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    ma_uint32 tail = ma_atomic_load_32(&AUDIO.Command.tail);
+    AudioVoice *freeVoice = NULL;
+    int instances = 0;
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.pool[i];
+
+        if (IsAudioVoiceBusy(voice, tail))
+        {
+            if (voice->source == source) instances++;
+        }
+        else if (freeVoice == NULL) freeVoice = voice;
+    }
+
+    AudioVoice *selected = freeVoice;
+
+    // Steal a voice: from the same sound if its instances limit is reached, from any sound if pool is full
+    bool limitReached = (source->maxInstances > 0) && (instances >= source->maxInstances);
+
+    if (limitReached || (freeVoice == NULL))
+    {
+        selected = NULL;
+
+        for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+        {
+            AudioVoice *voice = &AUDIO.Voice.pool[i];
+
+            if (!IsAudioVoiceBusy(voice, tail) || voice->reserved || (voice->priority > priority)) continue;
+            if (limitReached && (voice->source != source)) continue;
+
+            if (selected == NULL) selected = voice;
+            else if (AUDIO.Voice.stealMode == AUDIO_VOICE_STEAL_QUIETEST)
+            {
+                float level = ma_atomic_load_f32(&voice->level);
+                float selectedLevel = ma_atomic_load_f32(&selected->level);
+
+                if ((level < selectedLevel) || ((level == selectedLevel) && ((ma_int32)(voice->order - selected->order) < 0))) selected = voice;
+            }
+            else if ((ma_int32)(voice->order - selected->order) < 0) selected = voice;
+        }
+    }
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    // Voices decoding cursor is only allocated once they play a compressed sound
+    if ((selected != NULL) && (source->compressed != NULL) && (selected->buffer->cursor == NULL))
+    {
+        selected->buffer->cursor = (AudioCompressedCursor *)RL_CALLOC(1, sizeof(AudioCompressedCursor));
+        if (selected->buffer->cursor == NULL) selected = NULL;
+    }
+#endif
+
+    AudioCommand command = { 0 };
+
+    if (selected != NULL)
+    {
+        int index = (int)(selected - AUDIO.Voice.pool);
+
+        // Instance id generation is increased on every play, so ids of stolen instances become invalid
+        unsigned int generation = (selected->id >> 16) + 1;
+        if (generation > 0xffff) generation = 1;
+
+        selected->id = (generation << 16) | (unsigned int)index;
+        selected->source = source;
+        selected->priority = priority;
+        selected->order = AUDIO.Voice.order++;
+        selected->reserved = true;      // Voice is busy and can not be stolen until play command is pushed
+
+        command = (AudioCommand){ .type = AUDIO_COMMAND_VOICE_PLAY, .buffer = selected->buffer, .source = source, .frames = (unsigned int)index };
+    }
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+
+    // Play command is pushed with voices pool unlocked, pushing could wait for the mixer if commands queue is full
+    if (selected != NULL)
+    {
+        ma_uint32 ticket = PushAudioCommand(command);
+
+        ma_spinlock_lock(&AUDIO.Voice.lock);
+
+        selected->ticket = ticket;
+        selected->reserved = false;
+        instance = selected->id;
+
+        ma_spinlock_unlock(&AUDIO.Voice.lock);
+    }
+
+    return instance;
+}
+
+// Stop a sound instance
+void StopSoundInstance(unsigned int instance)
+{
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    AudioVoice *voice = GetAudioVoice(instance);
+    if (voice != NULL)
+    {
+        StopAudioBuffer(voice->buffer);
+        voice->source = NULL;
+    }
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+}
+
+// Check if a sound instance is currently playing
+bool IsSoundInstancePlaying(unsigned int instance)
+{
+    bool result = false;
+
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    AudioVoice *voice = GetAudioVoice(instance);
+    if (voice != NULL) result = IsAudioVoiceBusy(voice, ma_atomic_load_32(&AUDIO.Command.tail));
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+
+    return result;
+}
+
+// Set volume for a sound instance (1.0 is max level)
+void SetSoundInstanceVolume(unsigned int instance, float volume)
+{
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    AudioVoice *voice = GetAudioVoice(instance);
+    if (voice != NULL) SetAudioBufferVolume(voice->buffer, volume);
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+}
+
+// Set pitch for a sound instance (1.0 is base level)
+void SetSoundInstancePitch(unsigned int instance, float pitch)
+{
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    AudioVoice *voice = GetAudioVoice(instance);
+    if (voice != NULL) SetAudioBufferPitch(voice->buffer, pitch);
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+}
+
+// Set pan for a sound instance (0.5 is center)
+void SetSoundInstancePan(unsigned int instance, float pan)
+{
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    AudioVoice *voice = GetAudioVoice(instance);
+    if (voice != NULL) SetAudioBufferPan(voice->buffer, pan);
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+}
+
+// Set maximum number of instances of a sound playing at once (0 for no limit)
+void SetSoundMaxInstances(Sound sound, int maxInstances)
+{
+    if (sound.stream.buffer != NULL)
+    {
+        ma_spinlock_lock(&AUDIO.Voice.lock);
+        sound.stream.buffer->maxInstances = (maxInstances > 0)? maxInstances : 0;
+        ma_spinlock_unlock(&AUDIO.Voice.lock);
+    }
+}
+
+// Set voices stealing mode, used when no voice is available (AudioVoiceStealMode)
+void SetAudioVoiceStealMode(int mode)
+{
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+    AUDIO.Voice.stealMode = mode;
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1338,72 +2574,312 @@ void UnloadWaveSamples(float *samples)
     RL_FREE(samples);
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Music loading and stream playing
-//----------------------------------------------------------------------------------
-
-// Load music stream from file
-Music LoadMusicStream(const char *fileName)
+// Load rhythm analysis from wave: onsets, tempo and beat grid
+// NOTE: Onsets are detected by peak picking spectral flux of a downmixed mono signal,
+// tempo is estimated by autocorrelation of the onset envelope, beat grid phase is the
+// offset that best aligns beats with the onset envelope
+WaveRhythm LoadWaveRhythm(Wave wave)
 {
-    Music music = { 0 };
-    bool musicLoaded = false;
+    WaveRhythm rhythm = { 0 };
 
-    if (false) { }
-#if defined(SUPPORT_FILEFORMAT_WAV)
-    else if (IsFileExtension(fileName, ".wav"))
+    if (!IsWaveValid(wave))
     {
-        drwav *ctxWav = RL_CALLOC(1, sizeof(drwav));
-        bool success = drwav_init_file(ctxWav, fileName, NULL);
-
-        if (success)
-        {
-            music.ctxType = MUSIC_AUDIO_WAV;
-            music.ctxData = ctxWav;
-            int sampleSize = ctxWav->bitsPerSample;
-            if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
+        TRACELOG(LOG_WARNING, "WAVE: Rhythm analysis requires a valid wave");
+        return rhythm;
+    }
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
-            music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
-            music.looping = true;   // Looping enabled by default
-            musicLoaded = true;
-        }
-        else
-        {
-            RL_FREE(ctxWav);
-        }
+    if (wave.frameCount < AUDIO_ANALYSIS_FFT_SIZE)
+    {
+        TRACELOG(LOG_WARNING, "WAVE: Rhythm analysis requires at least %i frames", AUDIO_ANALYSIS_FFT_SIZE);
+        return rhythm;
     }
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-    else if (IsFileExtension(fileName, ".ogg"))
+
+    // Downmix samples to mono (in place)
+    float *samples = LoadWaveSamples(wave);
+
+    for (unsigned int i = 0; i < wave.frameCount; i++)
     {
-        // Open ogg audio stream
-        stb_vorbis *ctxOgg = stb_vorbis_open_filename(fileName, NULL, NULL);
+        float sum = 0.0f;
+        for (unsigned int c = 0; c < wave.channels; c++) sum += samples[i*wave.channels + c];
+        samples[i] = sum/(float)wave.channels;
+    }
 
-        if (ctxOgg != NULL)
-        {
-            music.ctxType = MUSIC_AUDIO_OGG;
-            music.ctxData = ctxOgg;
-            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+    // Init FFT tables
+    float *window = (float *)RL_MALLOC(AUDIO_ANALYSIS_FFT_SIZE*sizeof(float));
+    float *twiddleRe = (float *)RL_MALLOC(AUDIO_ANALYSIS_FFT_SIZE*sizeof(float));
+    float *twiddleIm = (float *)RL_MALLOC(AUDIO_ANALYSIS_FFT_SIZE*sizeof(float));
+    int *bitReverse = (int *)RL_MALLOC(AUDIO_ANALYSIS_FFT_SIZE*sizeof(int));
 
-            // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+    InitAudioFFTTables(window, twiddleRe, twiddleIm, bitReverse);
 
-            // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
-            music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
-            music.looping = true;   // Looping enabled by default
-            musicLoaded = true;
-        }
-        else
-        {
-            stb_vorbis_close(ctxOgg);
-        }
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-    else if (IsFileExtension(fileName, ".mp3"))
+    // Compute spectral flux, long waves are split in chunks processed by several threads
+    int fluxCount = (int)((wave.frameCount - AUDIO_ANALYSIS_FFT_SIZE)/AUDIO_ANALYSIS_HOP_SIZE) + 1;
+    float *flux = (float *)RL_CALLOC(fluxCount, sizeof(float));
+
+    int threadCount = fluxCount/256;
+    if (threadCount > AUDIO_ANALYSIS_THREADS) threadCount = AUDIO_ANALYSIS_THREADS;
+    if (threadCount < 1) threadCount = 1;
+
+    WaveFluxTask tasks[AUDIO_ANALYSIS_THREADS] = { 0 };
+
+    for (int i = 0; i < threadCount; i++)
     {
-        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
-        int result = drmp3_init_file(ctxMp3, fileName, NULL);
+        tasks[i].samples = samples;
+        tasks[i].window = window;
+        tasks[i].twiddleRe = twiddleRe;
+        tasks[i].twiddleIm = twiddleIm;
+        tasks[i].bitReverse = bitReverse;
+        tasks[i].flux = flux;
+        tasks[i].first = (int)((long long)fluxCount*i/threadCount);
+        tasks[i].last = (int)((long long)fluxCount*(i + 1)/threadCount);
+    }
+
+#if !defined(__EMSCRIPTEN__)
+    ma_thread threads[AUDIO_ANALYSIS_THREADS] = { 0 };
+    bool threadStarted[AUDIO_ANALYSIS_THREADS] = { 0 };
+
+    // First chunk is processed by the calling thread
+    for (int i = 1; i < threadCount; i++)
+    {
+        threadStarted[i] = (ma_thread_create(&threads[i], ma_thread_priority_normal, 0, WaveFluxThread, &tasks[i], NULL) == MA_SUCCESS);
+        if (!threadStarted[i]) ComputeWaveFlux(&tasks[i]);
+    }
+
+    ComputeWaveFlux(&tasks[0]);
+
+    for (int i = 1; i < threadCount; i++) if (threadStarted[i]) ma_thread_wait(&threads[i]);
+#else
+    for (int i = 0; i < threadCount; i++) ComputeWaveFlux(&tasks[i]);
+#endif
+
+    RL_FREE(bitReverse);
+    RL_FREE(twiddleIm);
+    RL_FREE(twiddleRe);
+    RL_FREE(window);
+    UnloadWaveSamples(samples);
+
+    // Normalize flux and compute onset envelope: flux above its local mean
+    float windowsPerSecond = (float)wave.sampleRate/(float)AUDIO_ANALYSIS_HOP_SIZE;
+    float windowTime = (float)AUDIO_ANALYSIS_FFT_SIZE/2.0f/(float)wave.sampleRate;   // Time offset of window center
+    int meanRadius = (int)(0.1f*windowsPerSecond) + 1;
+    int peakRadius = (int)(0.03f*windowsPerSecond) + 1;
+
+    float maxFlux = 0.0f;
+    for (int i = 0; i < fluxCount; i++) if (flux[i] > maxFlux) maxFlux = flux[i];
+    if (maxFlux > 0.0f) for (int i = 0; i < fluxCount; i++) flux[i] /= maxFlux;
+
+    double *fluxSum = (double *)RL_MALLOC((fluxCount + 1)*sizeof(double));
+    float *envelope = (float *)RL_MALLOC(fluxCount*sizeof(float));
+
+    fluxSum[0] = 0.0;
+    for (int i = 0; i < fluxCount; i++) fluxSum[i + 1] = fluxSum[i] + flux[i];
+
+    for (int i = 0; i < fluxCount; i++)
+    {
+        int start = (i - meanRadius < 0)? 0 : i - meanRadius;
+        int end = (i + meanRadius + 1 > fluxCount)? fluxCount : i + meanRadius + 1;
+        float mean = (float)((fluxSum[end] - fluxSum[start])/(end - start));
+
+        envelope[i] = (flux[i] > mean)? flux[i] - mean : 0.0f;
+    }
+
+    RL_FREE(fluxSum);
+
+    // Detect onsets: local envelope maximums over a minimum threshold
+    rhythm.onsets = (float *)RL_MALLOC(fluxCount*sizeof(float));
+    rhythm.onsetStrengths = (float *)RL_MALLOC(fluxCount*sizeof(float));
+
+    for (int i = 0; i < fluxCount; i++)
+    {
+        if (envelope[i] < 0.05f) continue;
+
+        bool isPeak = true;
+        for (int j = i - peakRadius; (j <= i + peakRadius) && isPeak; j++)
+        {
+            if ((j < 0) || (j >= fluxCount) || (j == i)) continue;
+            if ((envelope[j] > envelope[i]) || ((j < i) && (envelope[j] == envelope[i]))) isPeak = false;
+        }
+
+        if (isPeak)
+        {
+            rhythm.onsets[rhythm.onsetCount] = (float)i/windowsPerSecond + windowTime;
+            rhythm.onsetStrengths[rhythm.onsetCount] = flux[i];
+            rhythm.onsetCount++;
+        }
+    }
+
+    RL_FREE(flux);
+
+    // Estimate tempo: envelope autocorrelation weighted towards 120 bpm (one octave deviation)
+    // to reduce half/double tempo errors, peak lag refined with parabolic interpolation
+    int minLag = (int)(windowsPerSecond*60.0f/AUDIO_ANALYSIS_MAX_BPM);
+    int maxLag = (int)(windowsPerSecond*60.0f/AUDIO_ANALYSIS_MIN_BPM) + 1;
+    if (minLag < 1) minLag = 1;
+
+    if (maxLag + 1 < fluxCount)
+    {
+        float *correlation = (float *)RL_CALLOC(maxLag + 2, sizeof(float));
+
+        for (int lag = 0; lag <= maxLag + 1; lag++)
+        {
+            if ((lag > 0) && (lag < minLag - 1)) continue;
+
+            double sum = 0.0;
+            for (int i = 0; i + lag < fluxCount; i++) sum += envelope[i]*envelope[i + lag];
+            correlation[lag] = (float)(sum/(fluxCount - lag));
+        }
+
+        int bestLag = 0;
+        float bestScore = 0.0f;
+
+        for (int lag = minLag; lag <= maxLag; lag++)
+        {
+            float octaves = log2f(windowsPerSecond*60.0f/(float)lag/120.0f);
+            float score = correlation[lag]*expf(-0.5f*octaves*octaves);
+
+            if (score > bestScore)
+            {
+                bestScore = score;
+                bestLag = lag;
+            }
+        }
+
+        if (bestLag > 0)
+        {
+            float period = (float)bestLag;
+            float a = correlation[bestLag - 1], b = correlation[bestLag], c = correlation[bestLag + 1];
+            if ((a - 2.0f*b + c) < 0.0f) period += 0.5f*(a - c)/(a - 2.0f*b + c);
+
+            rhythm.confidence = (correlation[0] > 0.0f)? correlation[bestLag]/correlation[0] : 0.0f;
+            if (rhythm.confidence > 1.0f) rhythm.confidence = 1.0f;
+
+            // Find beat grid: period (refined around estimated one) and offset maximizing envelope sum at beat positions,
+            // small period errors accumulate along the whole wave, so refinement matters for long waves
+            float bestPeriod = period;
+            float bestOffset = 0.0f;
+            float bestSum = -1.0f;
+
+            for (int step = -40; step <= 40; step++)
+            {
+                float candidate = period*(1.0f + 0.0005f*(float)step);
+
+                for (int offset = 0; offset < (int)candidate; offset++)
+                {
+                    float sum = 0.0f;
+
+                    for (int beat = 0; ; beat++)
+                    {
+                        int position = (int)((float)offset + (float)beat*candidate + 0.5f);
+                        if (position >= fluxCount) break;
+                        sum += envelope[position];
+                    }
+
+                    if (sum > bestSum)
+                    {
+                        bestSum = sum;
+                        bestPeriod = candidate;
+                        bestOffset = (float)offset;
+                    }
+                }
+            }
+
+            rhythm.tempo = 60.0f*windowsPerSecond/bestPeriod;
+            rhythm.beatOffset = bestOffset/windowsPerSecond + windowTime;
+
+            // Generate beat grid along the whole wave
+            float duration = (float)wave.frameCount/(float)wave.sampleRate;
+            float beatTime = 60.0f/rhythm.tempo;
+
+            rhythm.beatCount = (int)((duration - rhythm.beatOffset)/beatTime) + 1;
+            rhythm.beats = (float *)RL_MALLOC(rhythm.beatCount*sizeof(float));
+
+            for (int i = 0; i < rhythm.beatCount; i++) rhythm.beats[i] = rhythm.beatOffset + (float)i*beatTime;
+        }
+
+        RL_FREE(correlation);
+    }
+
+    RL_FREE(envelope);
+
+    TRACELOG(LOG_INFO, "WAVE: Rhythm analyzed: %i onsets, %.2f bpm (confidence: %.2f)", rhythm.onsetCount, rhythm.tempo, rhythm.confidence);
+
+    return rhythm;
+}
+
+// Unload rhythm analysis data
+void UnloadWaveRhythm(WaveRhythm rhythm)
+{
+    RL_FREE(rhythm.onsets);
+    RL_FREE(rhythm.onsetStrengths);
+    RL_FREE(rhythm.beats);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Music loading and stream playing
+//----------------------------------------------------------------------------------
+
+// Load music stream from file
+Music LoadMusicStream(const char *fileName)
+{
+    Music music = { 0 };
+    bool musicLoaded = false;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (IsFileExtension(fileName, ".wav"))
+    {
+        drwav *ctxWav = RL_CALLOC(1, sizeof(drwav));
+        bool success = drwav_init_file(ctxWav, fileName, NULL);
+
+        if (success)
+        {
+            music.ctxType = MUSIC_AUDIO_WAV;
+            music.ctxData = ctxWav;
+            int sampleSize = ctxWav->bitsPerSample;
+            if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
+
+            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+        else
+        {
+            RL_FREE(ctxWav);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileExtension(fileName, ".ogg"))
+    {
+        // Open ogg audio stream
+        stb_vorbis *ctxOgg = stb_vorbis_open_filename(fileName, NULL, NULL);
+
+        if (ctxOgg != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_OGG;
+            music.ctxData = ctxOgg;
+            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+
+            // OGG bit rate defaults to 16 bit, it's enough for compressed format
+            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+
+            // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
+            music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+        else
+        {
+            stb_vorbis_close(ctxOgg);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileExtension(fileName, ".mp3"))
+    {
+        drmp3 *ctxMp3 = RL_CALLOC(1, sizeof(drmp3));
+        int result = drmp3_init_file(ctxMp3, fileName, NULL);
 
         if (result > 0)
         {
@@ -1465,7 +2941,7 @@ Music LoadMusicStream(const char *fileName)
     else if (IsFileExtension(fileName, ".xm"))
     {
         jar_xm_context_t *ctxXm = NULL;
-        int result = jar_xm_create_context_from_file(&ctxXm, AUDIO.System.device.sampleRate, fileName);
+        int result = jar_xm_create_context_from_file(&ctxXm, AUDIO.System.sampleRate, fileName);
 
         if (result == 0)    // XM AUDIO.System.context created successfully
         {
@@ -1478,7 +2954,7 @@ Music LoadMusicStream(const char *fileName)
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadAudioStream(AUDIO.System.sampleRate, bits, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1502,7 +2978,7 @@ Music LoadMusicStream(const char *fileName)
             music.ctxType = MUSIC_MODULE_MOD;
             music.ctxData = ctxMod;
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
+            music.stream = LoadAudioStream(AUDIO.System.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1522,6 +2998,10 @@ Music LoadMusicStream(const char *fileName)
     }
     else
     {
+        // Music is mixed on music bus by default
+        AudioCommand command = { .type = AUDIO_COMMAND_BUS, .buffer = music.stream.buffer, .bus = AUDIO_BUS_MUSIC };
+        PushAudioCommand(command);
+
         // Show some music stream info
         TRACELOG(LOG_INFO, "FILEIO: [%s] Music file loaded successfully", fileName);
         TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
@@ -1663,7 +3143,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
     else if ((strcmp(fileType, ".xm") == 0) || (strcmp(fileType, ".XM") == 0))
     {
         jar_xm_context_t *ctxXm = NULL;
-        int result = jar_xm_create_context_safe(&ctxXm, (const char *)data, dataSize, AUDIO.System.device.sampleRate);
+        int result = jar_xm_create_context_safe(&ctxXm, (const char *)data, dataSize, AUDIO.System.sampleRate);
         if (result == 0)    // XM AUDIO.System.context created successfully
         {
             music.ctxType = MUSIC_MODULE_XM;
@@ -1675,7 +3155,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             else if (AUDIO_DEVICE_FORMAT == ma_format_u8) bits = 8;
 
             // NOTE: Only stereo is supported for XM
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, bits, 2);
+            music.stream = LoadAudioStream(AUDIO.System.sampleRate, bits, 2);
             music.frameCount = (unsigned int)jar_xm_get_remaining_samples(ctxXm);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             jar_xm_reset(ctxXm);    // Make sure we start at the beginning of the song
@@ -1715,7 +3195,7 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
             music.ctxData = ctxMod;
 
             // NOTE: Only stereo is supported for MOD
-            music.stream = LoadAudioStream(AUDIO.System.device.sampleRate, 16, 2);
+            music.stream = LoadAudioStream(AUDIO.System.sampleRate, 16, 2);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1735,6 +3215,10 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
     }
     else
     {
+        // Music is mixed on music bus by default
+        AudioCommand command = { .type = AUDIO_COMMAND_BUS, .buffer = music.stream.buffer, .bus = AUDIO_BUS_MUSIC };
+        PushAudioCommand(command);
+
         // Show some music stream info
         TRACELOG(LOG_INFO, "FILEIO: Music data loaded successfully");
         TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
@@ -1759,8 +3243,13 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
     UnloadAudioStream(music.stream);
 
+    // Decoder must be stopped before closing music context
+    if (decoder != NULL) UnloadMusicDecoder(decoder);
+
     if (music.ctxData != NULL)
     {
         if (false) { }
@@ -1771,7 +3260,12 @@ void UnloadMusicStream(Music music)
         else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
 #endif
 #if defined(SUPPORT_FILEFORMAT_MP3)
-        else if (music.ctxType == MUSIC_AUDIO_MP3) { drmp3_uninit((drmp3 *)music.ctxData); RL_FREE(music.ctxData); }
+        else if (music.ctxType == MUSIC_AUDIO_MP3)
+        {
+            RL_FREE(((drmp3 *)music.ctxData)->pSeekPoints);   // Seek index memory is owned by raudio
+            drmp3_uninit((drmp3 *)music.ctxData);
+            RL_FREE(music.ctxData);
+        }
 #endif
 #if defined(SUPPORT_FILEFORMAT_QOA)
         else if (music.ctxType == MUSIC_AUDIO_QOA) qoaplay_close((qoaplay_desc *)music.ctxData);
@@ -1809,8 +3303,15 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL) ma_mutex_lock(&decoder->lock);
+
     StopAudioStream(music.stream);
 
+    // Wait for the mixer to stop, stream sub-buffers are reset on stopping
+    SyncAudioCommands(ma_atomic_load_32(&AUDIO.Command.head));
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1836,6 +3337,19 @@ void StopMusicStream(Music music)
 #endif
         default: break;
     }
+
+    if (decoder != NULL)
+    {
+        // Decoded frames are discarded, decoder restarts from the beginning
+        AudioCommand command = { .type = AUDIO_COMMAND_RESET, .buffer = music.stream.buffer, .frames = 0 };
+        SyncAudioCommands(PushAudioCommand(command));
+
+        decoder->framesDecoded = 0;
+        ma_atomic_store_32(&decoder->finished, false);
+        if (decoder->stretch != NULL) ResetMusicStretch(decoder->stretch);
+
+        ma_mutex_unlock(&decoder->lock);
+    }
 }
 
 // Seek music to a certain position (in seconds)
@@ -1846,6 +3360,10 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL) ma_mutex_lock(&decoder->lock);
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1855,7 +3373,13 @@ void SeekMusicStream(Music music, float position)
         case MUSIC_AUDIO_OGG: stb_vorbis_seek_frame((stb_vorbis *)music.ctxData, positionInFrames); break;
 #endif
 #if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames); break;
+        case MUSIC_AUDIO_MP3:
+        {
+            // Seek index is built on first seek (if not imported), seeking without it decodes from the start
+            if (((drmp3 *)music.ctxData)->pSeekPoints == NULL) BuildMusicSeekIndex(music);
+
+            drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, positionInFrames);
+        } break;
 #endif
 #if defined(SUPPORT_FILEFORMAT_QOA)
         case MUSIC_AUDIO_QOA:
@@ -1873,11 +3397,125 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    music.stream.buffer->isSubBufferProcessed[0] = true;
-    music.stream.buffer->isSubBufferProcessed[1] = true;
-    ma_mutex_unlock(&AUDIO.System.lock);
+    // Stream sub-buffers are reset by the mixer, we wait for it to avoid
+    // refilling them with new position data before the reset takes place
+    AudioCommand command = { .type = AUDIO_COMMAND_RESET, .buffer = music.stream.buffer, .frames = positionInFrames };
+    SyncAudioCommands(PushAudioCommand(command));
+
+    if (decoder != NULL)
+    {
+        decoder->framesDecoded = positionInFrames%music.frameCount;
+        ma_atomic_store_32(&decoder->finished, false);
+        if (decoder->stretch != NULL) ResetMusicStretch(decoder->stretch);
+
+        ma_mutex_unlock(&decoder->lock);
+    }
+}
+
+// Export music seek index to file, it can be imported to skip index building on next runs
+// NOTE: Only MP3 music requires a seek index, OGG and FLAC seeking is already bounded
+bool ExportMusicSeekIndex(Music music, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    if ((music.ctxType == MUSIC_AUDIO_MP3) && (music.ctxData != NULL))
+    {
+        drmp3 *ctxMp3 = (drmp3 *)music.ctxData;
+        MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+        if (decoder != NULL) ma_mutex_lock(&decoder->lock);
+
+        if ((ctxMp3->pSeekPoints != NULL) || BuildMusicSeekIndex(music))
+        {
+            // File format: "rMSI" id, music frame count, seek points count and seek points,
+            // every seek point: byte offset (8 bytes), frame (8 bytes), frames to discard (2 + 2 bytes)
+            unsigned int pointCount = ctxMp3->seekPointCount;
+            int dataSize = 12 + pointCount*20;
+            unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+
+            memcpy(data, "rMSI", 4);
+            memcpy(data + 4, &music.frameCount, 4);
+            memcpy(data + 8, &pointCount, 4);
+
+            for (unsigned int i = 0; i < pointCount; i++)
+            {
+                unsigned char *point = data + 12 + i*20;
+                memcpy(point, &ctxMp3->pSeekPoints[i].seekPosInBytes, 8);
+                memcpy(point + 8, &ctxMp3->pSeekPoints[i].pcmFrameIndex, 8);
+                memcpy(point + 16, &ctxMp3->pSeekPoints[i].mp3FramesToDiscard, 2);
+                memcpy(point + 18, &ctxMp3->pSeekPoints[i].pcmFramesToDiscard, 2);
+            }
+
+            success = SaveFileData(fileName, data, dataSize);
+            RL_FREE(data);
+        }
+
+        if (decoder != NULL) ma_mutex_unlock(&decoder->lock);
+    }
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Music seek index exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export music seek index", fileName);
+
+    return success;
+}
+
+// Import music seek index from file, exported with ExportMusicSeekIndex() for the same music
+bool ImportMusicSeekIndex(Music music, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    if ((music.ctxType == MUSIC_AUDIO_MP3) && (music.ctxData != NULL))
+    {
+        int dataSize = 0;
+        unsigned char *data = LoadFileData(fileName, &dataSize);
+
+        if ((data != NULL) && (dataSize >= 12) && (memcmp(data, "rMSI", 4) == 0))
+        {
+            unsigned int frameCount = 0;
+            unsigned int pointCount = 0;
+            memcpy(&frameCount, data + 4, 4);
+            memcpy(&pointCount, data + 8, 4);
+
+            // Index must match the music, a different file would seek to wrong positions
+            if ((frameCount == music.frameCount) && (pointCount > 0) && ((unsigned int)(dataSize - 12)/20 == pointCount))
+            {
+                drmp3_seek_point *points = (drmp3_seek_point *)RL_CALLOC(pointCount, sizeof(drmp3_seek_point));
+
+                for (unsigned int i = 0; i < pointCount; i++)
+                {
+                    const unsigned char *point = data + 12 + i*20;
+                    memcpy(&points[i].seekPosInBytes, point, 8);
+                    memcpy(&points[i].pcmFrameIndex, point + 8, 8);
+                    memcpy(&points[i].mp3FramesToDiscard, point + 16, 2);
+                    memcpy(&points[i].pcmFramesToDiscard, point + 18, 2);
+                }
+
+                drmp3 *ctxMp3 = (drmp3 *)music.ctxData;
+                MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+                if (decoder != NULL) ma_mutex_lock(&decoder->lock);
+
+                drmp3_seek_point *previous = ctxMp3->pSeekPoints;
+                success = drmp3_bind_seek_table(ctxMp3, pointCount, points);
+
+                if (success) RL_FREE(previous);
+                else RL_FREE(points);
+
+                if (decoder != NULL) ma_mutex_unlock(&decoder->lock);
+            }
+        }
+
+        UnloadFileData(data);
+    }
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Music seek index imported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to import music seek index", fileName);
+
+    return success;
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1885,6 +3523,19 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    MusicDecoder *decoder = music.stream.buffer->decoder;
+
+    if (decoder != NULL)
+    {
+        // Music is decoded on decoder thread, just update looping state
+        // and rewind music once it has been fully played
+        ma_atomic_store_32(&decoder->looping, music.looping);
+
+        if (ma_atomic_load_32(&decoder->finished) && !IsAudioBufferPlaying(music.stream.buffer)) StopMusicStream(music);
+
+        return;
+    }
+
     ma_mutex_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -1903,132 +3554,23 @@ void UpdateMusicStream(Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) continue; // No refilling required, move to next sub-buffer
 
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
 
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
+        ReadMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
+
+        UpdateAudioStream(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
-        switch (music.ctxType)
+        ma_atomic_store_32(&music.stream.buffer->framesProcessed, ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount);
+
+        if (framesLeft <= subBufferSizeInFrames)
         {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
-
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
-
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
-
-        if (framesLeft <= subBufferSizeInFrames)
-        {
-            if (!music.looping)
+            if (!music.looping)
             {
                 ma_mutex_unlock(&AUDIO.System.lock);
                 // Streaming is ending, we filled latest frames from input
@@ -2091,24 +3633,123 @@ float GetMusicTimePlayed(Music music)
         }
         else
 #endif
+        if (music.stream.buffer->decoder != NULL)
+        {
+            // Using music decoder, frames processed are the frames read by the mixer
+            int framesPlayed = (int)(ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount);
+            secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
+        }
+        else
         {
-            ma_mutex_lock(&AUDIO.System.lock);
-            //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
+            // NOTE: Values are read without locking the mixer, they could be updated while
+            // reading them but it only affects to the precision of the returned value
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesInFirstBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[0])? 0 : subBufferSize;
+            int framesInSecondBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[1])? 0 : subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
     return secondsPlayed;
 }
 
+// Get music playhead, music frame being output by the device
+// NOTE: Position is interpolated between mixer periods and compensated for device latency,
+// it is read without locking the mixer so it can be called every frame
+unsigned int GetMusicPlayheadFrames(Music music)
+{
+    return (unsigned int)GetMusicPlayheadPosition(music);
+}
+
+// Get music playhead position in beats, from music tempo (bpm) and first beat offset (in seconds)
+float GetMusicBeatPosition(Music music, float bpm, float offset)
+{
+    if (music.stream.sampleRate == 0) return 0.0f;
+
+    double seconds = GetMusicPlayheadPosition(music)/(double)music.stream.sampleRate;
+
+    return (float)((seconds - (double)offset)*(double)bpm/60.0);
+}
+
+// Set music stream prebuffer, decoding music on a background thread
+// NOTE: Decoder keeps up to prebuffer frames decoded ahead, UpdateMusicStream() is still required
+// to update music looping and rewind it once finished, use 0 frames to decode on UpdateMusicStream()
+void SetMusicStreamPrebuffer(Music music, int frames)
+{
+    if ((music.stream.buffer == NULL) || (music.frameCount == 0)) return;
+
+    MusicDecoder *decoder = music.stream.buffer->decoder;
+
+    if (decoder != NULL)
+    {
+        AudioCommand command = { .type = AUDIO_COMMAND_DECODER, .buffer = music.stream.buffer, .decoder = NULL };
+        SyncAudioCommands(PushAudioCommand(command));
+
+        UnloadMusicDecoder(decoder);
+    }
+
+    if (frames > 0)
+    {
+        // Prebuffer must be at least one device period to avoid continuous underruns
+        if ((unsigned int)frames < AUDIO.System.periodSize) frames = AUDIO.System.periodSize;
+
+        decoder = LoadMusicDecoder(music, frames);
+
+        if (decoder != NULL)
+        {
+            AudioCommand command = { .type = AUDIO_COMMAND_DECODER, .buffer = music.stream.buffer, .decoder = decoder };
+            SyncAudioCommands(PushAudioCommand(command));
+        }
+    }
+}
+
+// Get music stream underruns, number of times decoded frames were not ready for the mixer
+unsigned int GetMusicStreamUnderruns(Music music)
+{
+    unsigned int underruns = 0;
+
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) underruns = ma_atomic_load_32(&music.stream.buffer->decoder->underruns);
+
+    return underruns;
+}
+
+// Set tempo for a music, keeping its pitch (1.0 is base tempo, 0.5 is half speed)
+// NOTE: Music is time-stretched on its decoder thread, prebuffering music if required,
+// so tempo changes are heard once prebuffered frames have been played
+void SetMusicTempo(Music music, float tempo)
+{
+    if (music.stream.buffer == NULL) return;
+
+    if (tempo < MUSIC_TEMPO_MIN) tempo = MUSIC_TEMPO_MIN;
+    else if (tempo > MUSIC_TEMPO_MAX) tempo = MUSIC_TEMPO_MAX;
+
+    ma_atomic_exchange_f32(&music.stream.buffer->tempo, tempo);
+
+    if ((tempo != 1.0f) && (music.stream.buffer->decoder == NULL)) SetMusicStreamPrebuffer(music, music.stream.sampleRate/4);
+}
+
+// Queue next music to play after music, crossfading them (crossfade in seconds, 0.0f for none)
+// NOTE: Gapless transition starts next music at the sample following music end (crossfade overlaps music end),
+// otherwise transition starts as soon as next music is prebuffered, both musics must be updated like any music
+// WARNING: Musics are switched to decoder thread streaming if not prebuffered yet, for the mixer to know
+// where music ends, a playing music switched this way restarts from its last decoded frame
+void QueueMusicStream(Music music, Music next, float crossfade, bool gapless)
+{
+    if ((music.stream.buffer == NULL) || (music.stream.buffer == next.stream.buffer)) return;
+
+    // Next music first frames are decoded ahead on its decoder thread, so the transition never waits on the program
+    if (music.stream.buffer->decoder == NULL) SetMusicStreamPrebuffer(music, music.stream.sampleRate/2);
+    if ((next.stream.buffer != NULL) && (next.stream.buffer->decoder == NULL)) SetMusicStreamPrebuffer(next, next.stream.sampleRate/2);
+
+    AudioCommand command = { .type = AUDIO_COMMAND_QUEUE, .buffer = music.stream.buffer, .source = next.stream.buffer, .frames = music.frameCount, .flag = gapless };
+    command.value = (crossfade > 0.0f)? crossfade : 0.0f;
+    PushAudioCommand(command);
+}
+
 // Load audio stream (to stream audio pcm data)
 AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
@@ -2121,10 +3762,10 @@ AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, un
     ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
 
     // The size of a streaming buffer must be at least double the size of a period
-    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    unsigned int periodSize = AUDIO.System.periodSize;
 
     // If the buffer is not set, compute one that would give us a buffer good enough for a decent frame rate
-    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? AUDIO.System.device.sampleRate/30 : AUDIO.Buffer.defaultSize;
+    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? AUDIO.System.sampleRate/30 : AUDIO.Buffer.defaultSize;
 
     if (subBufferSize < periodSize) subBufferSize = periodSize;
 
@@ -2161,11 +3802,65 @@ void UnloadAudioStream(AudioStream stream)
 // Update audio stream buffers with data
 // NOTE 1: Only updates one buffer of the stream source: dequeue -> update -> queue
 // NOTE 2: To dequeue a buffer it needs to be processed: IsAudioStreamProcessed()
+// NOTE 3: No lock required, a processed sub-buffer is owned by the program until it's marked as not processed
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if ((stream.buffer != NULL) && (stream.buffer->ring != NULL))
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Stream is fed by PushAudioStreamFrames(), sub-buffers can not be updated");
+        return;
+    }
+
+    if (stream.buffer != NULL)
+    {
+        bool isSubBufferProcessed[2] = { 0 };
+        isSubBufferProcessed[0] = ma_atomic_load_explicit_32(&stream.buffer->isSubBufferProcessed[0], ma_atomic_memory_order_acquire);
+        isSubBufferProcessed[1] = ma_atomic_load_explicit_32(&stream.buffer->isSubBufferProcessed[1], ma_atomic_memory_order_acquire);
+
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
+        {
+            ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
+
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
+            {
+                // Both buffers are available for updating
+                // Update the one at the cursor position, mixer always waits at the start of a sub-buffer
+                subBufferToUpdate = ma_atomic_load_32(&stream.buffer->frameCursorPos)/subBufferSizeInFrames;
+                if (subBufferToUpdate > 1) subBufferToUpdate = 0;
+            }
+            else
+            {
+                // Just update whichever sub-buffer is processed
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
+            }
+
+            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+
+            // Does this API expect a whole buffer to be updated in one go?
+            // Assuming so, but if not will need to change this logic
+            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            {
+                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+                memcpy(subBuffer, data, bytesToWrite);
+
+                // Any leftover frames should be filled with zeros
+                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+                // Total frames processed in buffer is always the complete size, filled with 0 if required
+                ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, subBufferSizeInFrames);
+
+                // Sub-buffer is given back to the mixer, data must be written before
+                ma_atomic_store_explicit_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], false, ma_atomic_memory_order_release);
+            }
+            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+        }
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
 }
 
 // Check if any audio stream buffers requires refill
@@ -2173,11 +3868,81 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
-    return result;
+    return (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]));
+}
+
+// Push frames to audio stream, any number of frames, returns the number of frames written
+// NOTE: First push switches the stream to a ring buffer (sized as the stream buffer), sub-buffers are
+// not used anymore; frames not fitting in the ring are dropped and counted as an overrun
+int PushAudioStreamFrames(AudioStream stream, const void *data, int frameCount)
+{
+    if ((stream.buffer == NULL) || (data == NULL) || (frameCount <= 0)) return 0;
+
+    AudioBuffer *buffer = stream.buffer;
+
+    if (buffer->ring == NULL)
+    {
+        ma_pcm_rb *ring = (ma_pcm_rb *)RL_CALLOC(1, sizeof(ma_pcm_rb));
+
+        if ((ring == NULL) || (ma_pcm_rb_init(buffer->format, buffer->converter.channelsIn, buffer->sizeInFrames, NULL, NULL, ring) != MA_SUCCESS))
+        {
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create frames ring buffer");
+            RL_FREE(ring);
+            return 0;
+        }
+
+        // Ring is only set once, mixer must use it before any frame is pushed
+        AudioCommand command = { .type = AUDIO_COMMAND_RING, .buffer = buffer, .ring = ring };
+        SyncAudioCommands(PushAudioCommand(command));
+    }
+
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(buffer->format, buffer->converter.channelsIn);
+    ma_uint32 framesWritten = 0;
+
+    // Ring buffer space could wrap, so it requires up to two writes
+    while (framesWritten < (ma_uint32)frameCount)
+    {
+        ma_uint32 framesToWrite = (ma_uint32)frameCount - framesWritten;
+        void *ringBuffer = NULL;
+
+        ma_pcm_rb_acquire_write(buffer->ring, &framesToWrite, &ringBuffer);
+        if (framesToWrite == 0) break;
+
+        memcpy(ringBuffer, (const unsigned char *)data + (framesWritten*frameSizeInBytes), framesToWrite*frameSizeInBytes);
+        ma_pcm_rb_commit_write(buffer->ring, framesToWrite);
+
+        framesWritten += framesToWrite;
+    }
+
+    if (framesWritten < (ma_uint32)frameCount) ma_atomic_fetch_add_32(&buffer->overruns, 1);
+
+    return (int)framesWritten;
+}
+
+// Get number of frames that can be pushed to audio stream without overrun
+int GetAudioStreamWritableFrames(AudioStream stream)
+{
+    int frames = 0;
+
+    if (stream.buffer != NULL)
+    {
+        if (stream.buffer->ring == NULL) frames = (int)stream.buffer->sizeInFrames;
+        else frames = (int)ma_pcm_rb_available_write(stream.buffer->ring);
+    }
+
+    return frames;
+}
+
+// Get audio stream underruns count, times pushed frames were not enough for the mixer
+unsigned int GetAudioStreamUnderruns(AudioStream stream)
+{
+    return (stream.buffer != NULL)? ma_atomic_load_32(&stream.buffer->underruns) : 0;
+}
+
+// Get audio stream overruns count, times pushed frames did not fit in the ring buffer
+unsigned int GetAudioStreamOverruns(AudioStream stream)
+{
+    return (stream.buffer != NULL)? ma_atomic_load_32(&stream.buffer->overruns) : 0;
 }
 
 // Play audio stream
@@ -2239,63 +4004,35 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
     if (stream.buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        AudioCommand command = { .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback };
+        PushAudioCommand(command);
     }
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
 // The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
-// a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
+// a given stream, the mixer iterates through the list to find the end. That way we don't need a pointer to the last element
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer == NULL) return;
 
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
+    processor->stats = GetAudioProcessorStatsIndex(process, true);
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    AudioCommand command = { .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor };
+    PushAudioCommand(command);
 }
 
 // Remove processor from audio stream
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
+    if (stream.buffer == NULL) return;
 
-        processor = next;
-    }
+    AudioCommand command = { .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .callback = process };
+    SyncAudioCommands(PushAudioCommand(command));
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    FreeAudioProcessorGarbage();
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2303,52 +4040,161 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
+    processor->stats = GetAudioProcessorStatsIndex(process, true);
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
+    AudioCommand command = { .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor };
+    PushAudioCommand(command);
+}
 
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
+// Remove processor from audio pipeline
+void DetachAudioMixedProcessor(AudioCallback process)
+{
+    AudioCommand command = { .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .callback = process };
+    SyncAudioCommands(PushAudioCommand(command));
+
+    FreeAudioProcessorGarbage();
+}
+
+// Get audio processor callback average time per mixer callback (in seconds)
+// NOTE: Time is accumulated for all processors attached with this callback (streams, buses and mixed output)
+float GetAudioProcessorTime(AudioCallback processor)
+{
+    float time = 0.0f;
+
+    int index = GetAudioProcessorStatsIndex(processor, false);
+    ma_uint64 callbackCount = ma_atomic_load_64(&AUDIO.Stats.callbackCount);
+
+    if ((index >= 0) && (callbackCount > 0)) time = (float)((double)ma_atomic_load_64(&AUDIO.Stats.processors[index].time)/1000000000.0/(double)callbackCount);
+
+    return time;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Audio buses
+//----------------------------------------------------------------------------------
+
+// Set volume for an audio bus (1.0 is max level)
+// NOTE: Bus gain changes are ramped by the mixer to avoid clicks
+void SetAudioBusVolume(int bus, float volume)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_VOLUME, .bus = bus, .value = volume };
+    PushAudioCommand(command);
+}
+
+// Set bus ducking, bus volume is reduced by amount [0..1] while trigger bus is playing
+// NOTE: Attack and release times are in seconds, a negative trigger bus disables ducking
+void SetAudioBusDucking(int bus, int triggerBus, float amount, float attack, float release)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || (triggerBus == bus) || (triggerBus >= MAX_AUDIO_BUSES)) return;
+
+    if (amount < 0.0f) amount = 0.0f;
+    else if (amount > 1.0f) amount = 1.0f;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_DUCKING, .bus = bus, .value = (float)((triggerBus < 0)? -1 : triggerBus) };
+    command.values[0] = amount;
+    command.values[1] = (attack > 0.0f)? attack : 0.0f;
+    command.values[2] = (release > 0.0f)? release : 0.0f;
+    PushAudioCommand(command);
+}
+
+// Add built-in effect to bus effects chain, returns effect index on the chain (-1 on failure)
+// NOTE: Bus effects are applied once to the bus submix, not to every sound mixed into it
+int AddAudioBusEffect(int bus, int type)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || (type < AUDIO_EFFECT_LOWPASS) || (type > AUDIO_EFFECT_REVERB)) return -1;
+
+    AudioBus *audioBus = &AUDIO.buses[bus];
+
+    if (audioBus->loadedCount >= MAX_AUDIO_BUS_EFFECTS)
     {
-        processor->prev = last;
-        last->next = processor;
+        TRACELOG(LOG_WARNING, "AUDIO: Bus %i effects chain is full, MAX_AUDIO_BUS_EFFECTS: %i", bus, MAX_AUDIO_BUS_EFFECTS);
+        return -1;
     }
-    else AUDIO.mixedProcessor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    AudioEffect *effect = LoadAudioEffect(type);
+    if (effect == NULL) return -1;
+
+    int index = audioBus->loadedCount;
+    audioBus->loaded[index] = effect;
+    audioBus->loadedCount++;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_ADD_EFFECT, .bus = bus, .effect = effect };
+    PushAudioCommand(command);
+
+    return index;
 }
 
-// Remove processor from audio pipeline
-void DetachAudioMixedProcessor(AudioCallback process)
+// Set bus effect parameter, parameters meaning depends on effect type (see AudioEffectType)
+void SetAudioBusEffectParam(int bus, int effect, int param, float value)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES) || (param < 0) || (param >= 4)) return;
+    if ((effect < 0) || (effect >= AUDIO.buses[bus].loadedCount)) return;
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_EFFECT_PARAM, .effect = AUDIO.buses[bus].loaded[effect], .frames = (unsigned int)param, .value = value };
+    PushAudioCommand(command);
+}
 
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+// Remove all effects from bus effects chain
+void ClearAudioBusEffects(int bus)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
 
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_CLEAR_EFFECTS, .bus = bus };
+    SyncAudioCommands(PushAudioCommand(command));
 
-            RL_FREE(processor);
-        }
+    // Effects are not used by the mixer anymore
+    AudioBus *audioBus = &AUDIO.buses[bus];
+    for (int i = 0; i < audioBus->loadedCount; i++) UnloadAudioEffect(audioBus->loaded[i]);
+    audioBus->loadedCount = 0;
+}
 
-        processor = next;
-    }
+// Attach audio processor to bus, it receives the bus submix samples as 'float'
+void AttachAudioBusProcessor(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+    processor->process = process;
+    processor->stats = GetAudioProcessorStatsIndex(process, true);
+
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_ATTACH_PROCESSOR, .bus = bus, .processor = processor };
+    PushAudioCommand(command);
+}
+
+// Detach audio processor from bus
+void DetachAudioBusProcessor(int bus, AudioCallback process)
+{
+    if ((bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS_DETACH_PROCESSOR, .bus = bus, .callback = process };
+    SyncAudioCommands(PushAudioCommand(command));
+
+    FreeAudioProcessorGarbage();
+}
+
+// Set output bus for a sound, sound instances played from it use the same bus
+void SetSoundBus(Sound sound, int bus)
+{
+    SetAudioStreamBus(sound.stream, bus);
+}
+
+// Set output bus for a music stream
+void SetMusicBus(Music music, int bus)
+{
+    SetAudioStreamBus(music.stream, bus);
+}
+
+// Set output bus for an audio stream
+void SetAudioStreamBus(AudioStream stream, int bus)
+{
+    if ((stream.buffer == NULL) || (bus < 0) || (bus >= MAX_AUDIO_BUSES)) return;
+
+    AudioCommand command = { .type = AUDIO_COMMAND_BUS, .buffer = stream.buffer, .bus = bus };
+    PushAudioCommand(command);
 }
 
 
@@ -2369,23 +4215,35 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
+        audioBuffer->framesRead += frameCount;
 
         return frameCount;
     }
 
+    // Using music decoder ring buffer
+    if (audioBuffer->decoder != NULL) return ReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+
+    // Using stream frames ring buffer
+    if (audioBuffer->ring != NULL) return ReadAudioStreamRingFrames(audioBuffer, framesOut, frameCount);
+
+    // Using compressed sound data
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    if (audioBuffer->compressed != NULL) return ReadAudioCompressedFrames(audioBuffer, framesOut, frameCount);
+#endif
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
     if (currentSubBufferIndex > 1) return 0;
 
-    // Another thread can update the processed state of buffers, so
-    // we just take a copy here to try and avoid potential synchronization problems
+    // Another thread can update the processed state of buffers, so we just take a copy here,
+    // acquire ordering guarantees sub-buffer data written by the program is visible to the mixer
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = ma_atomic_load_explicit_32(&audioBuffer->isSubBufferProcessed[0], ma_atomic_memory_order_acquire);
+    isSubBufferProcessed[1] = ma_atomic_load_explicit_32(&audioBuffer->isSubBufferProcessed[1], ma_atomic_memory_order_acquire);
 
-    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->format, audioBuffer->converter.channelsIn);
 
     // Fill out every frame until we find a buffer that's marked as processed. Then fill the remainder with 0
     ma_uint32 framesRead = 0;
@@ -2422,13 +4280,14 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
-        // If we've read to the end of the buffer, mark it as processed
+        // If we've read to the end of the buffer, mark it as processed,
+        // release ordering hands the sub-buffer back to the program once we are done reading it
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_store_explicit_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], true, ma_atomic_memory_order_release);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2442,6 +4301,8 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         }
     }
 
+    audioBuffer->framesRead += framesRead;
+
     // Zero-fill excess
     ma_uint32 totalFramesRemaining = (frameCount - framesRead);
     if (totalFramesRemaining > 0)
@@ -2457,26 +4318,240 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     return framesRead;
 }
 
-// Reads audio data from an AudioBuffer object in device format, returned data will be in a format appropriate for mixing
-static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+// Reads audio data from a music decoder ring buffer, filled by the decoder thread
+// NOTE: Like any stream, missing frames are filled with silence, buffer is stopped once music is fully played
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
 {
-    // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
-    // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
-    // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
-    // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
-    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    MusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->format, audioBuffer->converter.channelsIn);
+    ma_uint32 framesRead = 0;
 
-    ma_uint32 totalOutputFramesProcessed = 0;
-    while (totalOutputFramesProcessed < frameCount)
+    // Ring buffer data could wrap, so it requires up to two reads
+    while (framesRead < frameCount)
     {
-        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
-        ma_uint64 inputFramesToProcessThisIteration = 0;
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *ringBuffer = NULL;
 
-        (void)ma_data_converter_get_required_input_frame_count(&audioBuffer->converter, outputFramesToProcessThisIteration, &inputFramesToProcessThisIteration);
-        if (inputFramesToProcessThisIteration > inputBufferFrameCap)
-        {
-            inputFramesToProcessThisIteration = inputBufferFrameCap;
+        ma_pcm_rb_acquire_read(&decoder->ring, &framesToRead, &ringBuffer);
+        if (framesToRead == 0) break;
+
+        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), ringBuffer, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(&decoder->ring, framesToRead);
+
+        framesRead += framesToRead;
+    }
+
+    // Time-stretched frames are scaled back to music frames, for music time played
+    ma_uint32 musicFrames = framesRead;
+    float tempo = ma_atomic_load_f32(&audioBuffer->tempo);
+
+    if ((tempo != 1.0f) || (audioBuffer->tempoFrames > 0.0))
+    {
+        double tempoFrames = audioBuffer->tempoFrames + (double)framesRead*tempo;
+        musicFrames = (ma_uint32)tempoFrames;
+        audioBuffer->tempoFrames = tempoFrames - musicFrames;
+    }
+
+    ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, musicFrames);
+    audioBuffer->framesRead += musicFrames;
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        if (ma_atomic_load_32(&decoder->finished)) StopAudioBufferInLockedState(audioBuffer);
+        else
+        {
+            ma_atomic_fetch_add_32(&decoder->underruns, 1);
+            ma_atomic_fetch_add_32(&AUDIO.Stats.streamUnderruns, 1);
+        }
+    }
+
+    return frameCount;
+}
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Reads audio data from compressed sound data, decoding slices on demand
+// NOTE: Like static buffers, silence filled after a non-looping sound end is not reported as read
+static ma_uint32 ReadAudioCompressedFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    const AudioCompressed *compressed = audioBuffer->compressed;
+    AudioCompressedCursor *cursor = audioBuffer->cursor;
+    const ma_uint32 channels = compressed->channels;
+    float *frames = (float *)framesOut;
+    ma_uint32 framesRead = 0;
+    ma_uint32 framesDecoded = 0;
+
+    double timeStart = ma_timer_get_time_in_seconds(&AUDIO.System.timer);
+
+    while ((cursor != NULL) && (framesRead < frameCount))
+    {
+        ma_uint32 position = audioBuffer->frameCursorPos;
+
+        if ((cursor->windowCount == 0) || (position < cursor->windowFrame) || (position >= (cursor->windowFrame + cursor->windowCount)))
+        {
+            DecodeAudioCompressedSlice(compressed, cursor, position);
+            framesDecoded += cursor->windowCount;
+        }
+
+        ma_uint32 offset = position - cursor->windowFrame;
+        ma_uint32 framesToRead = cursor->windowCount - offset;
+        if (framesToRead > (frameCount - framesRead)) framesToRead = frameCount - framesRead;
+
+        ConvertAudioSamplesS16ToF32(frames + framesRead*channels, cursor->window + offset*channels, framesToRead*channels);
+
+        framesRead += framesToRead;
+        position += framesToRead;
+
+        if (position >= compressed->frameCount)
+        {
+            ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
+
+            if (!audioBuffer->looping)
+            {
+                StopAudioBufferInLockedState(audioBuffer);
+                break;
+            }
+        }
+        else ma_atomic_store_32(&audioBuffer->frameCursorPos, position);
+    }
+
+    double timeEnd = ma_timer_get_time_in_seconds(&AUDIO.System.timer);
+
+    ma_atomic_fetch_add_64(&AUDIO.Stats.framesDecoded, framesDecoded);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.decodeTime, (ma_uint64)((timeEnd - timeStart)*1000000000.0));
+
+    ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, framesRead);
+    audioBuffer->framesRead += framesRead;
+
+    if (framesRead < frameCount) memset(frames + framesRead*channels, 0, (frameCount - framesRead)*channels*sizeof(float));
+
+    return framesRead;
+}
+
+// Decode compressed sound slice containing frame into cursor window
+// NOTE: Slices depend on previous ones LMS state, so a random start decodes from its QOA frame start
+static void DecodeAudioCompressedSlice(const AudioCompressed *compressed, AudioCompressedCursor *cursor, ma_uint32 frame)
+{
+    const ma_uint32 channels = compressed->channels;
+    const ma_uint32 frameSize = QOA_FRAME_SIZE(channels, QOA_SLICES_PER_FRAME);
+    const ma_uint32 sliceFrame = frame - frame%QOA_SLICE_LEN;
+
+    // LMS state is read from QOA frame header, unless slice follows the last one decoded
+    if ((cursor->windowCount == 0) || (sliceFrame != cursor->nextFrame) || ((sliceFrame%QOA_FRAME_LEN) == 0))
+    {
+        unsigned int p = 8 + (sliceFrame/QOA_FRAME_LEN)*frameSize + 8;
+
+        for (ma_uint32 c = 0; c < channels; c++)
+        {
+            qoa_uint64_t history = qoa_read_u64(compressed->data, &p);
+            qoa_uint64_t weights = qoa_read_u64(compressed->data, &p);
+
+            for (int i = 0; i < QOA_LMS_LEN; i++)
+            {
+                cursor->lms[c].history[i] = (signed short)(history >> 48);
+                history <<= 16;
+                cursor->lms[c].weights[i] = (signed short)(weights >> 48);
+                weights <<= 16;
+            }
+        }
+
+        cursor->nextFrame = sliceFrame - sliceFrame%QOA_FRAME_LEN;
+    }
+
+    while (cursor->nextFrame <= sliceFrame)
+    {
+        ma_uint32 qoaFrame = cursor->nextFrame/QOA_FRAME_LEN;
+        ma_uint32 slice = (cursor->nextFrame%QOA_FRAME_LEN)/QOA_SLICE_LEN;
+        ma_uint32 sliceLength = compressed->frameCount - cursor->nextFrame;
+        if (sliceLength > QOA_SLICE_LEN) sliceLength = QOA_SLICE_LEN;
+
+        // Slices are interleaved by channel after QOA frame header and LMS states
+        unsigned int p = 8 + qoaFrame*frameSize + 8 + QOA_LMS_LEN*4*channels + slice*8*channels;
+
+        for (ma_uint32 c = 0; c < channels; c++)
+        {
+            qoa_uint64_t bits = qoa_read_u64(compressed->data, &p);
+            int scaleFactor = (bits >> 60) & 0xf;
+            bits <<= 4;
+
+            for (ma_uint32 i = 0; i < sliceLength; i++)
+            {
+                int predicted = qoa_lms_predict(&cursor->lms[c]);
+                int dequantized = qoa_dequant_tab[scaleFactor][(bits >> 61) & 0x7];
+                int reconstructed = qoa_clamp_s16(predicted + dequantized);
+
+                cursor->window[i*channels + c] = (short)reconstructed;
+                bits <<= 3;
+
+                qoa_lms_update(&cursor->lms[c], reconstructed, dequantized);
+            }
+        }
+
+        cursor->windowFrame = cursor->nextFrame;
+        cursor->windowCount = sliceLength;
+        cursor->nextFrame += QOA_SLICE_LEN;
+    }
+}
+#endif
+
+// Reads audio data from a stream frames ring buffer, filled by PushAudioStreamFrames()
+// NOTE: Stream keeps playing when ring runs out of frames, missing frames are filled with silence
+static ma_uint32 ReadAudioStreamRingFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->format, audioBuffer->converter.channelsIn);
+    ma_uint32 framesRead = 0;
+
+    // Ring buffer data could wrap, so it requires up to two reads
+    while (framesRead < frameCount)
+    {
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *ringBuffer = NULL;
+
+        ma_pcm_rb_acquire_read(audioBuffer->ring, &framesToRead, &ringBuffer);
+        if (framesToRead == 0) break;
+
+        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), ringBuffer, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(audioBuffer->ring, framesToRead);
+
+        framesRead += framesToRead;
+    }
+
+    ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, framesRead);
+    audioBuffer->framesRead += framesRead;
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, (frameCount - framesRead)*frameSizeInBytes);
+        ma_atomic_fetch_add_32(&audioBuffer->underruns, 1);
+        ma_atomic_fetch_add_32(&AUDIO.Stats.streamUnderruns, 1);
+    }
+
+    return frameCount;
+}
+
+// Reads audio data from an AudioBuffer object in device format, returned data will be in a format appropriate for mixing
+static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    // What's going on here is that we're continuously converting data from the AudioBuffer's internal format to the mixing format, which
+    // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
+    // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
+    // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
+    ma_uint8 inputBuffer[4096] = { 0 };
+    float inputSamples[2048] = { 0 };   // Signed 16 bit input converted to float (input buffer samples capacity)
+    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->format, audioBuffer->converter.channelsIn);
+    const bool inputConverted = (audioBuffer->format != audioBuffer->converter.formatIn);
+
+    ma_uint32 totalOutputFramesProcessed = 0;
+    while (totalOutputFramesProcessed < frameCount)
+    {
+        ma_uint64 outputFramesToProcessThisIteration = frameCount - totalOutputFramesProcessed;
+        ma_uint64 inputFramesToProcessThisIteration = 0;
+
+        (void)ma_data_converter_get_required_input_frame_count(&audioBuffer->converter, outputFramesToProcessThisIteration, &inputFramesToProcessThisIteration);
+        if (inputFramesToProcessThisIteration > inputBufferFrameCap)
+        {
+            inputFramesToProcessThisIteration = inputBufferFrameCap;
         }
 
         float *runningFramesOut = framesOut + (totalOutputFramesProcessed*audioBuffer->converter.channelsOut);
@@ -2484,7 +4559,16 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
         // At this point we can convert the data to our mixing format
         ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration);
         ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
-        ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
+        const void *input = inputBuffer;
+
+        // Signed 16 bit data is converted to float here, with SIMD kernels (miniaudio conversion is scalar)
+        if (inputConverted)
+        {
+            ConvertAudioSamplesS16ToF32(inputSamples, (const short *)inputBuffer, (ma_uint32)inputFramesProcessedThisIteration*audioBuffer->converter.channelsIn);
+            input = inputSamples;
+        }
+
+        ma_data_converter_process_pcm_frames(&audioBuffer->converter, input, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
 
         totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration; // Safe cast
 
@@ -2508,215 +4592,2663 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Mixer state is only modified through commands applied here, the mix lock is never waited on:
+    // it is only contended when a program thread had to apply commands itself because the
+    // mixer was not running, in that case we just output silence for this period
+    if (ma_atomic_exchange_explicit_32(&AUDIO.System.mixLock, 1, ma_atomic_memory_order_acquire) != 0)
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
-        {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+        // Audio clock keeps running, frames have been rendered (as silence)
+        ma_atomic_fetch_add_64(&AUDIO.System.framesRendered, frameCount);
+        ma_atomic_fetch_add_32(&AUDIO.Stats.xruns, 1);
+        return;
+    }
 
-            ma_uint32 framesRead = 0;
+    MixAudioOutputInLockedState((float *)pFramesOut, frameCount);
 
-            while (1)
-            {
-                if (framesRead >= frameCount) break;
+    ma_spinlock_unlock(&AUDIO.System.mixLock);
+}
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+// Mix all playing buffers into output, assuming the mixer is locked
+// NOTE: Output must be initialized to 0, it is used by device callback and offline rendering
+static void MixAudioOutputInLockedState(float *pFramesOut, ma_uint32 frameCount)
+{
+    // Audio clock frame at the start of this period
+    ma_uint64 clock = ma_atomic_load_64(&AUDIO.System.framesRendered);
 
-                while (framesToRead > 0)
-                {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+    // Period start time, audio clock is interpolated from it between periods
+    double timeStart = ma_timer_get_time_in_seconds(&AUDIO.System.timer);
+    if (!AUDIO.System.isOffline) WriteAudioPlayhead(&AUDIO.System.output, clock, (ma_uint64)(timeStart*1000000000.0), 1.0f);
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
-                    {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
-                    }
+    AUDIO.Stats.mixedVoices = 0;
+    AUDIO.Stats.mixedResamplers = 0;
+    {
+        // Apply all pending commands sent by the program
+        ProcessAudioCommands();
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
+        // Queued streams transitions are scheduled before mixing, they can start within this period
+        UpdateAudioQueueInLockedState(clock, frameCount);
 
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+        // Buses are mixed in chunks, fitting bus mixing buffers
+        for (ma_uint32 framesMixed = 0; framesMixed < frameCount; framesMixed += AUDIO_BUS_FRAMES)
+        {
+            ma_uint32 framesToMix = frameCount - framesMixed;
+            if (framesToMix > AUDIO_BUS_FRAMES) framesToMix = AUDIO_BUS_FRAMES;
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+            MixAudioBusesInLockedState(pFramesOut + framesMixed*AUDIO.System.channels, framesToMix, clock + framesMixed);
+        }
+    }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+    ApplyAudioProcessors(AUDIO.mixedProcessor, pFramesOut, frameCount);
 
-                    if (!audioBuffer->playing)
-                    {
-                        framesRead = frameCount;
-                        break;
-                    }
+    // Master volume and clipping applied to mixed output
+    ApplyAudioMasterVolume(pFramesOut, frameCount*AUDIO.System.channels, ma_atomic_load_f32(&AUDIO.System.masterVolume));
 
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
-                    {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
-                    }
-                }
+    // Spectrum tap, mixed output is just copied, analysis is done by GetAudioSpectrum()
+    if (ma_atomic_load_32(&AUDIO.Spectrum.enabled)) WriteAudioSpectrumFrames(pFramesOut, frameCount);
 
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
-            }
-        }
-    }
+    ma_atomic_fetch_add_64(&AUDIO.System.framesRendered, frameCount);
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-    while (processor)
+    UpdateAudioCallbackStats(timeStart, frameCount);
+}
+
+// Update mixer callback stats, assuming the mixer is locked
+// NOTE: Counters are only written by the mixer, maximums do not require a compare-exchange loop
+static void UpdateAudioCallbackStats(double timeStart, ma_uint32 frameCount)
+{
+    double timeEnd = ma_timer_get_time_in_seconds(&AUDIO.System.timer);
+    double period = (double)frameCount/(double)AUDIO.System.sampleRate;
+    ma_uint64 time = (ma_uint64)((timeEnd - timeStart)*1000000000.0);
+
+    ma_atomic_fetch_add_64(&AUDIO.Stats.callbackCount, 1);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.callbackFrames, frameCount);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.callbackTime, time);
+    if (time > ma_atomic_load_64(&AUDIO.Stats.callbackTimeMax)) ma_atomic_store_64(&AUDIO.Stats.callbackTimeMax, time);
+
+    ma_uint32 load = (ma_uint32)((timeEnd - timeStart)/period*1000000.0);
+    if (load > ma_atomic_load_32(&AUDIO.Stats.callbackLoadMax)) ma_atomic_store_32(&AUDIO.Stats.callbackLoadMax, load);
+    if ((timeEnd - timeStart) > period) ma_atomic_fetch_add_32(&AUDIO.Stats.deadlineMisses, 1);
+
+    // Duration histogram, 4 bins per octave: bin = 4*log2(1 + microseconds)
+    int bin = (int)(4.0*log2(1.0 + (double)time/1000.0));
+    if (bin >= AUDIO_STATS_HISTOGRAM_BINS) bin = AUDIO_STATS_HISTOGRAM_BINS - 1;
+    ma_atomic_fetch_add_32(&AUDIO.Stats.callbackHistogram[bin], 1);
+
+    // Device xruns are not reported by every backend, a callback starting more than
+    // one period later than expected means the device ran out of frames to play
+    if (!AUDIO.System.isOffline)
     {
-        processor->process(pFramesOut, frameCount);
-        processor = processor->next;
+        if ((AUDIO.Stats.lastCallback > 0.0) && ((timeStart - AUDIO.Stats.lastCallback) > 2.0*AUDIO.Stats.lastPeriod)) ma_atomic_fetch_add_32(&AUDIO.Stats.xruns, 1);
+
+        AUDIO.Stats.lastCallback = timeStart;
+        AUDIO.Stats.lastPeriod = period;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_atomic_store_32(&AUDIO.Stats.activeVoices, (ma_uint32)AUDIO.Stats.mixedVoices);
+    ma_atomic_store_32(&AUDIO.Stats.activeResamplers, (ma_uint32)AUDIO.Stats.mixedResamplers);
 }
 
-// Main mixing function, pretty simple in this project, just an accumulation
-// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+// Mix all playing buffers into their buses and buses into output, assuming the mixer is locked
+// NOTE: Every pass over buses processes them independently, only the output accumulation is shared
+static void MixAudioBusesInLockedState(float *pFramesOut, ma_uint32 frameCount, ma_uint64 clock)
 {
-    const float localVolume = buffer->volume;
-    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    const ma_uint32 channels = AUDIO.System.channels;
 
-    if (channels == 2)  // We consider panning
+    // Buses with effects or processors are always processed, effects can have tails (reverb)
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
     {
-        const float left = buffer->pan;
-        const float right = 1.0f - left;
+        AudioBus *bus = &AUDIO.buses[i];
 
-        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        bus->active = false;
+        if ((bus->effectCount > 0) || (bus->processor != NULL)) GetAudioBusFrames(i, frameCount);
+    }
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    // Sources mixed on this chunk, counted for stats
+    int voices = 0;
+    int resamplers = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+    // Sources are mixed into their bus, bus buffer is only cleared if a source is playing
+    // NOTE: Playing state is read once, not playing buffers get no output buffer and only update their ramps
+    for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+    {
+        float *busFrames = IsAudioBufferPlayingInLockedState(audioBuffer)? GetAudioBusFrames(audioBuffer->bus, frameCount) : NULL;
 
-            frameOut += 2;
-            frameIn += 2;
+        if (busFrames != NULL)
+        {
+            voices++;
+            if (!IsAudioBufferDirect(audioBuffer)) resamplers++;
         }
+
+        MixAudioBufferInLockedState(audioBuffer, busFrames, frameCount, clock);
     }
-    else  // We do not consider panning
+
+    // Voices are stored contiguously, finished voices are removed swapping the last one into their place
+    for (int i = 0; i < AUDIO.Voice.activeCount;)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        AudioVoice *voice = AUDIO.Voice.active[i];
+
+        float *busFrames = IsAudioBufferPlayingInLockedState(voice->buffer)? GetAudioBusFrames(voice->buffer->bus, frameCount) : NULL;
+
+        if (busFrames != NULL)
         {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+            voices++;
+            if (!IsAudioBufferDirect(voice->buffer)) resamplers++;
+        }
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
+        MixAudioBufferInLockedState(voice->buffer, busFrames, frameCount, clock);
+        ma_atomic_store_f32(&voice->level, voice->buffer->volume);
+
+        if (!ma_atomic_load_32(&voice->buffer->playing))
+        {
+            voice->active = false;
+            AUDIO.Voice.active[i] = AUDIO.Voice.active[AUDIO.Voice.activeCount - 1];
+            AUDIO.Voice.activeCount--;
         }
+        else i++;
     }
-}
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
-{
-    bool result = false;
+    if (voices > AUDIO.Stats.mixedVoices) AUDIO.Stats.mixedVoices = voices;
+    if (resamplers > AUDIO.Stats.mixedResamplers) AUDIO.Stats.mixedResamplers = resamplers;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    // First pass: bus effects chain and processors, then bus level for ducking
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &AUDIO.buses[i];
+        bus->peak = 0.0f;
 
-    return result;
+        if (!bus->active) continue;
+
+        for (int e = 0; e < bus->effectCount; e++) ApplyAudioEffect(bus->effects[e], bus->frames, frameCount, channels);
+
+        ApplyAudioProcessors(bus->processor, bus->frames, frameCount);
+
+        bus->peak = GetAudioSamplesPeak(bus->frames, frameCount*channels);
+    }
+
+    // Second pass: bus gain with ducking, ramped along the chunk, mixed to output
+    const float chunkTime = (float)frameCount/(float)AUDIO.System.sampleRate;
+
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &AUDIO.buses[i];
+        float gain = bus->volume;
+
+        if (bus->duckTrigger >= 0)
+        {
+            // Ducking level follows trigger bus state, moving linearly with attack and release times
+            bool triggered = (AUDIO.buses[bus->duckTrigger].peak > AUDIO_BUS_DUCKING_LEVEL);
+            float time = triggered? bus->duckAttack : bus->duckRelease;
+            float step = (time > 0.0f)? chunkTime/time : 1.0f;
+
+            if (triggered) bus->duckLevel = (bus->duckLevel + step < 1.0f)? bus->duckLevel + step : 1.0f;
+            else bus->duckLevel = (bus->duckLevel - step > 0.0f)? bus->duckLevel - step : 0.0f;
+
+            gain *= (1.0f - bus->duckAmount*bus->duckLevel);
+        }
+
+        if (bus->active) MixAudioSamplesRamp(pFramesOut, bus->frames, frameCount, channels, bus->gain, gain);
+
+        bus->gain = gain;
+    }
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Mix an audio buffer for a period, assuming the mixer is locked
+// NOTE: Scheduled start and stop frames define the range of the period to be mixed,
+// output is NULL for buffers not playing, the caller checks playing state once for both decisions
+static void MixAudioBufferInLockedState(AudioBuffer *audioBuffer, float *pFramesOut, ma_uint32 frameCount, ma_uint64 clock)
 {
-    if (buffer != NULL)
+    // Only mix playing sounds, stopped or paused ones are ignored
+    if (pFramesOut != NULL)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        ma_uint32 framesStart = 0;
+        ma_uint32 framesEnd = frameCount;
+        bool stopScheduled = false;
+
+        if (audioBuffer->startFrame > clock)
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            if (audioBuffer->startFrame >= (clock + frameCount)) framesStart = frameCount;
+            else framesStart = (ma_uint32)(audioBuffer->startFrame - clock);
         }
+
+        if (audioBuffer->stopFrame < (clock + frameCount))
+        {
+            framesEnd = (audioBuffer->stopFrame > clock)? (ma_uint32)(audioBuffer->stopFrame - clock) : 0;
+            stopScheduled = true;
+        }
+
+        if (framesStart < framesEnd) MixAudioBufferFrames(audioBuffer, pFramesOut, framesStart, framesEnd, clock);
+
+        if (stopScheduled) StopAudioBufferInLockedState(audioBuffer);
+    }
+
+    // Scheduled ramps progress even if buffer is not playing
+    bool volumeRampFinished = UpdateAudioRamp(&audioBuffer->volume, &audioBuffer->volumeRamp, clock + frameCount);
+    bool panRampFinished = UpdateAudioRamp(&audioBuffer->pan, &audioBuffer->panRamp, clock + frameCount);
+    bool fadeRampFinished = UpdateAudioRamp(&audioBuffer->fade, &audioBuffer->fadeRamp, clock + frameCount);
+
+    if (volumeRampFinished || panRampFinished || fadeRampFinished) UpdateAudioBufferLevels(audioBuffer);
+
+    // Streams playhead anchor, source frames buffered by the resampler are not output yet
+    if (audioBuffer->usage == AUDIO_BUFFER_USAGE_STREAM)
+    {
+        ma_uint64 latency = ma_data_converter_get_input_latency(&audioBuffer->converter);
+        ma_uint64 position = (audioBuffer->framesRead > latency)? audioBuffer->framesRead - latency : 0;
+        bool advancing = (pFramesOut != NULL) && ma_atomic_load_32(&audioBuffer->playing) && (audioBuffer->startFrame <= (clock + frameCount));
+        float tempo = (audioBuffer->decoder != NULL)? ma_atomic_load_f32(&audioBuffer->tempo) : 1.0f;
+        float rate = advancing? tempo*audioBuffer->pitch*(float)audioBuffer->converter.sampleRateIn/(float)audioBuffer->converter.sampleRateOut : 0.0f;
+
+        WriteAudioPlayhead(&audioBuffer->playhead, clock + frameCount, position, rate);
     }
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount)
+// Mix audio buffer frames into output, for the [framesStart, framesEnd) range of the period
+// NOTE: Buffer is read from its current position, clock is the audio clock frame at the start of the period
+static void MixAudioBufferFrames(AudioBuffer *audioBuffer, float *pFramesOut, ma_uint32 framesStart, ma_uint32 framesEnd, ma_uint64 clock)
 {
-    if (stream.buffer != NULL)
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    // Compressed sounds are decoded in device format, if not pitched they also skip the data converter
+    if ((audioBuffer->compressed != NULL) && IsAudioBufferDirect(audioBuffer))
+    {
+        MixAudioBufferFramesCompressed(audioBuffer, pFramesOut, framesStart, framesEnd, clock);
+        return;
+    }
+#endif
+
+    // Sounds already in device format and not pitched skip the data converter
+    if (IsAudioBufferDirect(audioBuffer))
+    {
+        MixAudioBufferFramesDirect(audioBuffer, pFramesOut, framesStart, framesEnd, clock);
+        return;
+    }
+
+    ma_atomic_fetch_add_64(&AUDIO.Stats.framesConverted, framesEnd - framesStart);
+
+    ma_uint32 framesRead = framesStart;
+
+    while (1)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        if (framesRead >= framesEnd) break;
+
+        // Just read as much data as we can from the stream
+        ma_uint32 framesToRead = (framesEnd - framesRead);
+
+        while (framesToRead > 0)
         {
-            ma_uint32 subBufferToUpdate = 0;
+            float tempBuffer[1024] = { 0 }; // Frames for stereo
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            ma_uint32 framesToReadRightNow = framesToRead;
+            if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
             {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
-            }
-            else
-            {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
             }
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
-
-            // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
-
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+            ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+            if (framesJustRead > 0)
             {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+                float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.channels);
+                float *framesIn = tempBuffer;
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+                // Apply processors chain if defined
+                ApplyAudioProcessors(audioBuffer->processor, framesIn, framesJustRead);
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+                MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer, clock + framesRead);
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+                framesToRead -= framesJustRead;
+                framesRead += framesJustRead;
+            }
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+            if (!ma_atomic_load_32(&audioBuffer->playing))
+            {
+                framesRead = framesEnd;
+                break;
+            }
+
+            // If we weren't able to read all the frames we requested, break
+            if (framesJustRead < framesToReadRightNow)
+            {
+                if (!audioBuffer->looping)
+                {
+                    StopAudioBufferInLockedState(audioBuffer);
+                    break;
+                }
+                else
+                {
+                    // Should never get here, but just for safety,
+                    // move the cursor position back to the start and continue the loop
+                    ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
+                    continue;
+                }
             }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+
+        // If for some reason we weren't able to read every frame we'll need to break from the loop
+        // Not doing this could theoretically put us into an infinite loop
+        if (framesToRead > 0) break;
     }
 }
 
+// Mix audio buffer frames into output straight from buffer data, for the [framesStart, framesEnd) range of the period
+// NOTE: Only valid for buffers checked with IsAudioBufferDirect(), data is only copied if processors must be applied
+static void MixAudioBufferFramesDirect(AudioBuffer *audioBuffer, float *pFramesOut, ma_uint32 framesStart, ma_uint32 framesEnd, ma_uint64 clock)
+{
+    ma_uint32 framesRead = framesStart;
+
+    while (framesRead < framesEnd)
+    {
+        ma_uint32 cursor = audioBuffer->frameCursorPos;
+        ma_uint32 framesToRead = framesEnd - framesRead;
+        if (framesToRead > (audioBuffer->sizeInFrames - cursor)) framesToRead = audioBuffer->sizeInFrames - cursor;
+
+        float *framesOut = pFramesOut + (framesRead*AUDIO.System.channels);
+        const float *framesIn = (const float *)audioBuffer->data + (cursor*AUDIO_DEVICE_CHANNELS);
+
+        if (audioBuffer->processor == NULL) MixAudioFrames(framesOut, framesIn, framesToRead, audioBuffer, clock + framesRead);
+        else
+        {
+            // Processors work in place, so sound data is processed on a copy
+            float tempBuffer[1024] = { 0 };
+            ma_uint32 framesCopied = 0;
+
+            while (framesCopied < framesToRead)
+            {
+                ma_uint32 framesToCopy = framesToRead - framesCopied;
+                if (framesToCopy > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS) framesToCopy = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+
+                memcpy(tempBuffer, framesIn + (framesCopied*AUDIO_DEVICE_CHANNELS), framesToCopy*AUDIO_DEVICE_CHANNELS*sizeof(float));
+
+                ApplyAudioProcessors(audioBuffer->processor, tempBuffer, framesToCopy);
+
+                MixAudioFrames(framesOut + (framesCopied*AUDIO.System.channels), tempBuffer, framesToCopy, audioBuffer, clock + framesRead + framesCopied);
+                framesCopied += framesToCopy;
+            }
+        }
+
+        framesRead += framesToRead;
+        cursor += framesToRead;
+
+        if (cursor >= audioBuffer->sizeInFrames)
+        {
+            if (!audioBuffer->looping)
+            {
+                StopAudioBufferInLockedState(audioBuffer);
+                break;
+            }
+
+            cursor = 0;
+        }
+
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, cursor);
+    }
+
+    ma_atomic_fetch_add_64(&AUDIO.Stats.framesDirect, framesRead - framesStart);
+}
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Mix compressed sound frames into output once decoded, for the [framesStart, framesEnd) range of the period
+// NOTE: Only valid for buffers checked with IsAudioBufferDirect(), frames are decoded in device format
+static void MixAudioBufferFramesCompressed(AudioBuffer *audioBuffer, float *pFramesOut, ma_uint32 framesStart, ma_uint32 framesEnd, ma_uint64 clock)
+{
+    float tempBuffer[1024] = { 0 };     // Frames for stereo
+    ma_uint32 framesRead = framesStart;
+
+    while (framesRead < framesEnd)
+    {
+        ma_uint32 framesToRead = framesEnd - framesRead;
+        if (framesToRead > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS) framesToRead = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+
+        ma_uint32 framesJustRead = ReadAudioCompressedFrames(audioBuffer, tempBuffer, framesToRead);
+
+        if (framesJustRead > 0)
+        {
+            ApplyAudioProcessors(audioBuffer->processor, tempBuffer, framesJustRead);
+
+            MixAudioFrames(pFramesOut + (framesRead*AUDIO.System.channels), tempBuffer, framesJustRead, audioBuffer, clock + framesRead);
+            framesRead += framesJustRead;
+        }
+
+        // Sound stopped once its end is read (not looping)
+        if ((framesJustRead < framesToRead) || !ma_atomic_load_32(&audioBuffer->playing)) break;
+    }
+
+    ma_atomic_fetch_add_64(&AUDIO.Stats.framesDirect, framesRead - framesStart);
+}
+#endif
+
+// Check if an audio buffer can be mixed without the data converter, straight from its data
+// or decoded (compressed sounds), assuming the mixer is locked
+// NOTE: Sounds are converted to device format on loading, they only require the converter when pitched
+static bool IsAudioBufferDirect(AudioBuffer *audioBuffer)
+{
+    return ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STATIC) &&
+            (audioBuffer->callback == NULL) &&
+            (audioBuffer->decoder == NULL) &&
+            (((audioBuffer->data != NULL) && (audioBuffer->sizeInFrames > 0)) || (audioBuffer->compressed != NULL)) &&
+            (audioBuffer->pitch == 1.0f) &&
+            (audioBuffer->format == ma_format_f32) &&
+            (audioBuffer->converter.channelsIn == AUDIO_DEVICE_CHANNELS) &&
+            (audioBuffer->converter.sampleRateIn == AUDIO.System.sampleRate));
+}
+
+// Main mixing function, pretty simple in this project, just an accumulation
+// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer, ma_uint64 clock)
+{
+    const ma_uint32 channels = AUDIO.System.channels;
+
+    // Check if any scheduled ramp affects these frames, in that case volume and pan are computed per frame
+    bool ramping = (buffer->volumeRamp.active && (buffer->volumeRamp.startFrame < (clock + frameCount))) ||
+                   (buffer->panRamp.active && (buffer->panRamp.startFrame < (clock + frameCount))) ||
+                   (buffer->fadeRamp.active && (buffer->fadeRamp.startFrame < (clock + frameCount)));
+
+    if (ramping)
+    {
+        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        {
+            const float localVolume = GetAudioRampValue(buffer->volume, &buffer->volumeRamp, clock + frame)*GetAudioRampValue(buffer->fade, &buffer->fadeRamp, clock + frame);
+            float *frameOut = framesOut + (frame*channels);
+            const float *frameIn = framesIn + (frame*channels);
+
+            if (channels == 2)
+            {
+                const float left = GetAudioRampValue(buffer->pan, &buffer->panRamp, clock + frame);
+                const float right = 1.0f - left;
+
+                frameOut[0] += (frameIn[0]*localVolume*0.5f*left*(3.0f - left*left));
+                frameOut[1] += (frameIn[1]*localVolume*0.5f*right*(3.0f - right*right));
+            }
+            else
+            {
+                for (ma_uint32 c = 0; c < channels; c++) frameOut[c] += (frameIn[c]*localVolume);
+            }
+        }
+    }
+    else if (channels == 2) MixAudioSamplesStereo(framesOut, framesIn, frameCount, buffer->levels[0], buffer->levels[1]);  // We consider panning
+    else MixAudioSamples(framesOut, framesIn, frameCount*channels, buffer->volume*buffer->fade);  // We do not consider panning
+}
+
+// Mix stereo frames, output accumulates input multiplied by left and right levels
+static void MixAudioSamplesStereo(float *framesOut, const float *framesIn, ma_uint32 frameCount, float left, float right)
+{
+    const ma_uint32 sampleCount = frameCount*2;
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+    const __m256 levels = _mm256_setr_ps(left, right, left, right, left, right, left, right);
+    for (; (i + 8) <= sampleCount; i += 8) _mm256_storeu_ps(framesOut + i, _mm256_add_ps(_mm256_loadu_ps(framesOut + i), _mm256_mul_ps(_mm256_loadu_ps(framesIn + i), levels)));
+#elif defined(RAUDIO_SIMD_SSE2)
+    const __m128 levels = _mm_setr_ps(left, right, left, right);
+    for (; (i + 4) <= sampleCount; i += 4) _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), levels)));
+#elif defined(RAUDIO_SIMD_NEON)
+    const float levelsData[4] = { left, right, left, right };
+    const float32x4_t levels = vld1q_f32(levelsData);
+    for (; (i + 4) <= sampleCount; i += 4) vst1q_f32(framesOut + i, vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), levels));
+#endif
+
+    // Remaining frames (or all of them if no SIMD available)
+    for (; i < sampleCount; i += 2)
+    {
+        framesOut[i] += (framesIn[i]*left);
+        framesOut[i + 1] += (framesIn[i + 1]*right);
+    }
+}
+
+// Mix samples, output accumulates input multiplied by volume
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float volume)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+    const __m256 gain = _mm256_set1_ps(volume);
+    for (; (i + 8) <= sampleCount; i += 8) _mm256_storeu_ps(samplesOut + i, _mm256_add_ps(_mm256_loadu_ps(samplesOut + i), _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), gain)));
+#elif defined(RAUDIO_SIMD_SSE2)
+    const __m128 gain = _mm_set1_ps(volume);
+    for (; (i + 4) <= sampleCount; i += 4) _mm_storeu_ps(samplesOut + i, _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gain)));
+#elif defined(RAUDIO_SIMD_NEON)
+    const float32x4_t gain = vdupq_n_f32(volume);
+    for (; (i + 4) <= sampleCount; i += 4) vst1q_f32(samplesOut + i, vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gain));
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] += (samplesIn[i]*volume);
+}
+
+// Convert samples from signed 16 bit to float, same scale as miniaudio conversion: [-32768..32767] to [-1.0f..1.0f)
+static void ConvertAudioSamplesS16ToF32(float *samplesOut, const short *samplesIn, ma_uint32 sampleCount)
+{
+    const float scale = 1.0f/32768.0f;
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+    const __m256 factor = _mm256_set1_ps(scale);
+    for (; (i + 8) <= sampleCount; i += 8) _mm256_storeu_ps(samplesOut + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(samplesIn + i)))), factor));
+#elif defined(RAUDIO_SIMD_SSE2)
+    const __m128 factor = _mm_set1_ps(scale);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        // Samples are sign extended to 32 bit, placed on the high half and shifted back
+        const __m128i samples = _mm_loadu_si128((const __m128i *)(samplesIn + i));
+        _mm_storeu_ps(samplesOut + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16)), factor));
+        _mm_storeu_ps(samplesOut + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16)), factor));
+    }
+#elif defined(RAUDIO_SIMD_NEON)
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        const int16x8_t samples = vld1q_s16(samplesIn + i);
+        vst1q_f32(samplesOut + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))), scale));
+        vst1q_f32(samplesOut + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples))), scale));
+    }
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] = (float)samplesIn[i]*scale;
+}
+
+// Convert samples from float to signed 16 bit, same as miniaudio conversion (no dithering): clipped, scaled and truncated
+static void ConvertAudioSamplesF32ToS16(short *samplesOut, const float *samplesIn, ma_uint32 sampleCount)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+    const __m256 minimum = _mm256_set1_ps(-1.0f);
+    const __m256 maximum = _mm256_set1_ps(1.0f);
+    const __m256 factor = _mm256_set1_ps(32767.0f);
+    for (; (i + 16) <= sampleCount; i += 16)
+    {
+        const __m256i low = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(samplesIn + i), minimum), maximum), factor));
+        const __m256i high = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(samplesIn + i + 8), minimum), maximum), factor));
+
+        // Packing works per 128 bit lane, lanes are reordered after it
+        _mm256_storeu_si256((__m256i *)(samplesOut + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xd8));
+    }
+#elif defined(RAUDIO_SIMD_SSE2)
+    const __m128 minimum = _mm_set1_ps(-1.0f);
+    const __m128 maximum = _mm_set1_ps(1.0f);
+    const __m128 factor = _mm_set1_ps(32767.0f);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        const __m128i low = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(samplesIn + i), minimum), maximum), factor));
+        const __m128i high = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(samplesIn + i + 4), minimum), maximum), factor));
+        _mm_storeu_si128((__m128i *)(samplesOut + i), _mm_packs_epi32(low, high));
+    }
+#elif defined(RAUDIO_SIMD_NEON)
+    const float32x4_t minimum = vdupq_n_f32(-1.0f);
+    const float32x4_t maximum = vdupq_n_f32(1.0f);
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        const int32x4_t low = vcvtq_s32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(samplesIn + i), minimum), maximum), 32767.0f));
+        const int32x4_t high = vcvtq_s32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(vld1q_f32(samplesIn + i + 4), minimum), maximum), 32767.0f));
+        vst1q_s16(samplesOut + i, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+    }
+#endif
+
+    for (; i < sampleCount; i++)
+    {
+        float sample = samplesIn[i];
+        sample = (sample < -1.0f)? -1.0f : ((sample > 1.0f)? 1.0f : sample);
+        samplesOut[i] = (short)(sample*32767.0f);
+    }
+}
+
+// Mix frames, output accumulates input multiplied by a gain ramped linearly along the frames
+static void MixAudioSamplesRamp(float *framesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels, float gainStart, float gainEnd)
+{
+    if (gainStart == gainEnd)
+    {
+        if (gainEnd != 0.0f) MixAudioSamples(framesOut, framesIn, frameCount*channels, gainEnd);
+        return;
+    }
+
+    const float step = (gainEnd - gainStart)/(float)frameCount;
+
+    for (ma_uint32 f = 0; f < frameCount; f++)
+    {
+        const float gain = gainStart + step*(float)(f + 1);
+        for (ma_uint32 c = 0; c < channels; c++) framesOut[f*channels + c] += (framesIn[f*channels + c]*gain);
+    }
+}
+
+// Apply a gain per frame to all its channels
+static void ApplyAudioFrameGains(float *frames, const float *gains, ma_uint32 frameCount, ma_uint32 channels)
+{
+    ma_uint32 f = 0;
+
+    if (channels == 2)
+    {
+#if defined(RAUDIO_SIMD_AVX2) || defined(RAUDIO_SIMD_SSE2)
+        for (; (f + 2) <= frameCount; f += 2)
+        {
+            // Two frames gains are duplicated for both channels: g0, g0, g1, g1
+            __m128 gain = _mm_castpd_ps(_mm_load_sd((const double *)(gains + f)));
+            gain = _mm_unpacklo_ps(gain, gain);
+            _mm_storeu_ps(frames + f*2, _mm_mul_ps(_mm_loadu_ps(frames + f*2), gain));
+        }
+#elif defined(RAUDIO_SIMD_NEON)
+        for (; (f + 2) <= frameCount; f += 2)
+        {
+            const float32x2_t gain = vld1_f32(gains + f);
+            vst1q_f32(frames + f*2, vmulq_f32(vld1q_f32(frames + f*2), vcombine_f32(vdup_lane_f32(gain, 0), vdup_lane_f32(gain, 1))));
+        }
+#endif
+    }
+    else if (channels == 1)
+    {
+#if defined(RAUDIO_SIMD_AVX2) || defined(RAUDIO_SIMD_SSE2)
+        for (; (f + 4) <= frameCount; f += 4) _mm_storeu_ps(frames + f, _mm_mul_ps(_mm_loadu_ps(frames + f), _mm_loadu_ps(gains + f)));
+#elif defined(RAUDIO_SIMD_NEON)
+        for (; (f + 4) <= frameCount; f += 4) vst1q_f32(frames + f, vmulq_f32(vld1q_f32(frames + f), vld1q_f32(gains + f)));
+#endif
+    }
+
+    for (; f < frameCount; f++)
+    {
+        for (ma_uint32 c = 0; c < channels; c++) frames[f*channels + c] *= gains[f];
+    }
+}
+
+// Get samples peak level (absolute value)
+static float GetAudioSamplesPeak(const float *samples, ma_uint32 sampleCount)
+{
+    float peak = 0.0f;
+
+    for (ma_uint32 i = 0; i < sampleCount; i++)
+    {
+        float value = fabsf(samples[i]);
+        if (value > peak) peak = value;
+    }
+
+    return peak;
+}
+
+// Apply processors chain to frames, processors time is accumulated for stats
+static void ApplyAudioProcessors(rAudioProcessor *processor, void *frames, ma_uint32 frameCount)
+{
+    while (processor)
+    {
+        double timeStart = ma_timer_get_time_in_seconds(&AUDIO.System.timer);
+        processor->process(frames, frameCount);
+        ma_uint64 time = (ma_uint64)((ma_timer_get_time_in_seconds(&AUDIO.System.timer) - timeStart)*1000000000.0);
+
+        ma_atomic_fetch_add_64(&AUDIO.Stats.processorTime, time);
+        if (processor->stats >= 0) ma_atomic_fetch_add_64(&AUDIO.Stats.processors[processor->stats].time, time);
+
+        processor = processor->next;
+    }
+}
+
+// Get processor callback timing stats index, a free slot is claimed for the callback if requested
+// NOTE: Slots are never released, they are shared by all processors using the same callback
+static int GetAudioProcessorStatsIndex(AudioCallback process, bool claim)
+{
+    int index = -1;
+
+    for (int i = 0; (i < AUDIO_STATS_MAX_PROCESSORS) && (index < 0); i++)
+    {
+        void *current = ma_atomic_load_ptr(&AUDIO.Stats.processors[i].process);
+
+        if (current == (void *)process) index = i;
+        else if ((current == NULL) && claim)
+        {
+            // Slot could be claimed concurrently by another thread, maybe for the same callback
+            if (ma_atomic_compare_exchange_strong_ptr(&AUDIO.Stats.processors[i].process, &current, (void *)process) || (current == (void *)process)) index = i;
+        }
+        else if (current == NULL) break;
+    }
+
+    return index;
+}
+
+// Get samples dot product, used as similarity measure
+static float GetAudioSamplesDot(const float *a, const float *b, ma_uint32 sampleCount)
+{
+    float result = 0.0f;
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+    __m256 sum = _mm256_setzero_ps();
+    for (; (i + 8) <= sampleCount; i += 8) sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    result = _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, 1)));
+#elif defined(RAUDIO_SIMD_SSE2)
+    __m128 sum = _mm_setzero_ps();
+    for (; (i + 4) <= sampleCount; i += 4) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    result = _mm_cvtss_f32(_mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1)));
+#elif defined(RAUDIO_SIMD_NEON)
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (; (i + 4) <= sampleCount; i += 4) sum = vmlaq_f32(sum, vld1q_f32(a + i), vld1q_f32(b + i));
+    float32x2_t half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    result = vget_lane_f32(vpadd_f32(half, half), 0);
+#endif
+
+    for (; i < sampleCount; i++) result += a[i]*b[i];
+
+    return result;
+}
+
+// Downmix frames to mono, channels average
+static void DownmixAudioFrames(float *samplesOut, const float *framesIn, ma_uint32 frameCount, ma_uint32 channels)
+{
+    ma_uint32 f = 0;
+
+    if (channels == 1)
+    {
+        memcpy(samplesOut, framesIn, frameCount*sizeof(float));
+        return;
+    }
+
+    if (channels == 2)
+    {
+#if defined(RAUDIO_SIMD_AVX2) || defined(RAUDIO_SIMD_SSE2)
+        const __m128 half = _mm_set1_ps(0.5f);
+        for (; (f + 4) <= frameCount; f += 4)
+        {
+            // Four frames deinterleaved: l0, l1, l2, l3 and r0, r1, r2, r3
+            const __m128 a = _mm_loadu_ps(framesIn + f*2);
+            const __m128 b = _mm_loadu_ps(framesIn + f*2 + 4);
+            const __m128 left = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 right = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(samplesOut + f, _mm_mul_ps(_mm_add_ps(left, right), half));
+        }
+#elif defined(RAUDIO_SIMD_NEON)
+        for (; (f + 4) <= frameCount; f += 4)
+        {
+            const float32x4x2_t frames = vld2q_f32(framesIn + f*2);
+            vst1q_f32(samplesOut + f, vmulq_n_f32(vaddq_f32(frames.val[0], frames.val[1]), 0.5f));
+        }
+#endif
+    }
+
+    for (; f < frameCount; f++)
+    {
+        float sum = 0.0f;
+        for (ma_uint32 c = 0; c < channels; c++) sum += framesIn[f*channels + c];
+        samplesOut[f] = sum/channels;
+    }
+}
+
+// Overlap-add frames, output is overlap plus input windowed (first half),
+// overlap is replaced by next input windowed (second half, fade)
+static void OverlapAddAudioFrames(float *framesOut, float *overlap, const float *framesIn, const float *framesNext, const float *window, const float *fade, ma_uint32 frameCount, ma_uint32 channels)
+{
+    ma_uint32 f = 0;
+
+    if (channels == 2)
+    {
+#if defined(RAUDIO_SIMD_AVX2) || defined(RAUDIO_SIMD_SSE2)
+        for (; (f + 2) <= frameCount; f += 2)
+        {
+            // Two frames gains are duplicated for both channels: g0, g0, g1, g1
+            __m128 gainIn = _mm_castpd_ps(_mm_load_sd((const double *)(window + f)));
+            __m128 gainNext = _mm_castpd_ps(_mm_load_sd((const double *)(fade + f)));
+            gainIn = _mm_unpacklo_ps(gainIn, gainIn);
+            gainNext = _mm_unpacklo_ps(gainNext, gainNext);
+            _mm_storeu_ps(framesOut + f*2, _mm_add_ps(_mm_loadu_ps(overlap + f*2), _mm_mul_ps(gainIn, _mm_loadu_ps(framesIn + f*2))));
+            _mm_storeu_ps(overlap + f*2, _mm_mul_ps(gainNext, _mm_loadu_ps(framesNext + f*2)));
+        }
+#elif defined(RAUDIO_SIMD_NEON)
+        for (; (f + 2) <= frameCount; f += 2)
+        {
+            const float32x2_t gainIn = vld1_f32(window + f);
+            const float32x2_t gainNext = vld1_f32(fade + f);
+            vst1q_f32(framesOut + f*2, vaddq_f32(vld1q_f32(overlap + f*2), vmulq_f32(vcombine_f32(vdup_lane_f32(gainIn, 0), vdup_lane_f32(gainIn, 1)), vld1q_f32(framesIn + f*2))));
+            vst1q_f32(overlap + f*2, vmulq_f32(vcombine_f32(vdup_lane_f32(gainNext, 0), vdup_lane_f32(gainNext, 1)), vld1q_f32(framesNext + f*2)));
+        }
+#endif
+    }
+    else if (channels == 1)
+    {
+#if defined(RAUDIO_SIMD_AVX2) || defined(RAUDIO_SIMD_SSE2)
+        for (; (f + 4) <= frameCount; f += 4)
+        {
+            _mm_storeu_ps(framesOut + f, _mm_add_ps(_mm_loadu_ps(overlap + f), _mm_mul_ps(_mm_loadu_ps(window + f), _mm_loadu_ps(framesIn + f))));
+            _mm_storeu_ps(overlap + f, _mm_mul_ps(_mm_loadu_ps(fade + f), _mm_loadu_ps(framesNext + f)));
+        }
+#elif defined(RAUDIO_SIMD_NEON)
+        for (; (f + 4) <= frameCount; f += 4)
+        {
+            vst1q_f32(framesOut + f, vaddq_f32(vld1q_f32(overlap + f), vmulq_f32(vld1q_f32(window + f), vld1q_f32(framesIn + f))));
+            vst1q_f32(overlap + f, vmulq_f32(vld1q_f32(fade + f), vld1q_f32(framesNext + f)));
+        }
+#endif
+    }
+
+    for (; f < frameCount; f++)
+    {
+        for (ma_uint32 c = 0; c < channels; c++)
+        {
+            framesOut[f*channels + c] = overlap[f*channels + c] + window[f]*framesIn[f*channels + c];
+            overlap[f*channels + c] = fade[f]*framesNext[f*channels + c];
+        }
+    }
+}
+
+// Apply master volume to samples, clipping them to [-1.0f..1.0f] range
+static void ApplyAudioMasterVolume(float *samples, ma_uint32 sampleCount, float volume)
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+    const __m256 gain = _mm256_set1_ps(volume);
+    const __m256 minValue = _mm256_set1_ps(-1.0f);
+    const __m256 maxValue = _mm256_set1_ps(1.0f);
+    for (; (i + 8) <= sampleCount; i += 8) _mm256_storeu_ps(samples + i, _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(samples + i), gain), minValue), maxValue));
+#elif defined(RAUDIO_SIMD_SSE2)
+    const __m128 gain = _mm_set1_ps(volume);
+    const __m128 minValue = _mm_set1_ps(-1.0f);
+    const __m128 maxValue = _mm_set1_ps(1.0f);
+    for (; (i + 4) <= sampleCount; i += 4) _mm_storeu_ps(samples + i, _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(samples + i), gain), minValue), maxValue));
+#elif defined(RAUDIO_SIMD_NEON)
+    const float32x4_t gain = vdupq_n_f32(volume);
+    const float32x4_t minValue = vdupq_n_f32(-1.0f);
+    const float32x4_t maxValue = vdupq_n_f32(1.0f);
+    for (; (i + 4) <= sampleCount; i += 4) vst1q_f32(samples + i, vminq_f32(vmaxq_f32(vmulq_f32(vld1q_f32(samples + i), gain), minValue), maxValue));
+#endif
+
+    for (; i < sampleCount; i++)
+    {
+        float sample = samples[i]*volume;
+
+        if (sample < -1.0f) sample = -1.0f;
+        else if (sample > 1.0f) sample = 1.0f;
+
+        samples[i] = sample;
+    }
+}
+
+// Write mixed output frames to spectrum tap ring
+// NOTE: Only the mixer writes the ring, frames position is published after the copy
+static void WriteAudioSpectrumFrames(const float *frames, ma_uint32 frameCount)
+{
+    // Only the latest frames fitting in the ring are kept
+    if (frameCount > AUDIO_SPECTRUM_RING_FRAMES)
+    {
+        frames += (frameCount - AUDIO_SPECTRUM_RING_FRAMES)*AUDIO_DEVICE_CHANNELS;
+        frameCount = AUDIO_SPECTRUM_RING_FRAMES;
+    }
+
+    ma_uint32 position = AUDIO.Spectrum.framesWritten;
+    ma_uint32 offset = position & (AUDIO_SPECTRUM_RING_FRAMES - 1);
+    ma_uint32 firstCount = AUDIO_SPECTRUM_RING_FRAMES - offset;
+    if (firstCount > frameCount) firstCount = frameCount;
+
+    memcpy(AUDIO.Spectrum.ring + offset*AUDIO_DEVICE_CHANNELS, frames, firstCount*AUDIO_DEVICE_CHANNELS*sizeof(float));
+    memcpy(AUDIO.Spectrum.ring, frames + firstCount*AUDIO_DEVICE_CHANNELS, (frameCount - firstCount)*AUDIO_DEVICE_CHANNELS*sizeof(float));
+
+    ma_atomic_store_explicit_32(&AUDIO.Spectrum.framesWritten, position + frameCount, ma_atomic_memory_order_release);
+}
+
+// Update audio buffer stereo levels from its volume and pan
+static void UpdateAudioBufferLevels(AudioBuffer *buffer)
+{
+    const float left = buffer->pan;
+    const float right = 1.0f - left;
+
+    // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
+    buffer->levels[0] = buffer->volume*buffer->fade*0.5f*left*(3.0f - left*left);
+    buffer->levels[1] = buffer->volume*buffer->fade*0.5f*right*(3.0f - right*right);
+}
+
+// Get parameter value at an audio clock frame, considering its scheduled ramp
+static float GetAudioRampValue(float value, const AudioRamp *ramp, ma_uint64 frame)
+{
+    float result = value;
+
+    if (ramp->active && (frame >= ramp->startFrame))
+    {
+        if (frame >= (ramp->startFrame + ramp->length)) result = ramp->target;
+        else result = value + (ramp->target - value)*(float)(frame - ramp->startFrame)/(float)ramp->length;
+    }
+
+    return result;
+}
+
+// Update parameter value once its scheduled ramp is finished at given audio clock frame, returns true if finished
+static bool UpdateAudioRamp(float *value, AudioRamp *ramp, ma_uint64 frame)
+{
+    bool finished = false;
+
+    if (ramp->active && (frame >= (ramp->startFrame + ramp->length)))
+    {
+        *value = ramp->target;
+        ramp->active = false;
+        finished = true;
+    }
+
+    return finished;
+}
+
+// Check if an audio buffer is playing, assuming the mixer is locked
+static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+{
+    bool result = false;
+
+    if (buffer != NULL) result = (ma_atomic_load_32(&buffer->playing) && !ma_atomic_load_32(&buffer->paused));
+
+    return result;
+}
+
+// Stop an audio buffer, assuming the mixer is locked
+// NOTE: Buffer is always reset, even if it was not playing
+static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+{
+    if (buffer != NULL)
+    {
+        ma_atomic_store_32(&buffer->playing, false);
+        ma_atomic_store_32(&buffer->paused, false);
+        buffer->startFrame = 0;
+        buffer->stopFrame = AUDIO_CLOCK_NEVER;
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        ma_atomic_store_32(&buffer->framesProcessed, 0);
+        buffer->framesRead = 0;
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+    }
+}
+
+// Start queued streams transitions, assuming the mixer is locked
+// NOTE: Transitions are scheduled on the audio clock, next stream starts at sample precision within the period
+static void UpdateAudioQueueInLockedState(ma_uint64 clock, ma_uint32 frameCount)
+{
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        AudioBuffer *next = buffer->queued;
+
+        if ((next == NULL) || ma_atomic_load_32(&buffer->paused)) continue;
+
+        ma_uint64 startFrame = clock;       // Transition start, output frame where crossfade starts
+        ma_uint64 nextStartFrame = clock;   // Next stream start, earlier by its resampler latency
+        ma_uint32 fadeFrames = buffer->queuedFadeFrames;
+
+        if (ma_atomic_load_32(&buffer->playing))
+        {
+            if (buffer->queuedGapless && (buffer->queuedLength > 0))
+            {
+                // Stream end on the audio clock, from source frames left (including the ones buffered by the resampler)
+                // NOTE: Stream position wraps to 0 at its end, so it's a full length left only if nothing was read yet
+                ma_uint64 framesLeft = buffer->queuedLength - (buffer->framesRead%buffer->queuedLength);
+                if ((buffer->framesRead > 0) && (framesLeft == buffer->queuedLength)) framesLeft = 0;
+
+                // Frames buffered by the resamplers delay current stream end and next stream first frame alike
+                float tempo = (buffer->decoder != NULL)? ma_atomic_load_f32(&buffer->tempo) : 1.0f;
+                double rate = (double)tempo*buffer->pitch*(double)buffer->converter.sampleRateIn/(double)buffer->converter.sampleRateOut;
+                ma_uint64 endFrame = clock + (ma_uint64)((double)framesLeft/rate + 0.5) + ma_data_converter_get_output_latency(&buffer->converter);
+                ma_uint64 nextLatency = ma_data_converter_get_output_latency(&next->converter);
+
+                startFrame = (endFrame > (clock + fadeFrames))? endFrame - fadeFrames : clock;
+                nextStartFrame = (startFrame > (clock + nextLatency))? startFrame - nextLatency : clock;
+                fadeFrames = (ma_uint32)(endFrame - startFrame);
+
+                if (nextStartFrame >= (clock + frameCount)) continue;
+            }
+            else if ((next->decoder != NULL) && !ma_atomic_load_32(&next->decoder->finished) &&
+                     (ma_pcm_rb_available_read(&next->decoder->ring) < frameCount)) continue;    // Waiting for next stream prebuffering
+
+            // Current stream fades out and stops once the transition ends
+            if (fadeFrames > 0)
+            {
+                buffer->fade = GetAudioRampValue(buffer->fade, &buffer->fadeRamp, startFrame);
+                buffer->fadeRamp = (AudioRamp){ .target = 0.0f, .startFrame = startFrame, .length = fadeFrames, .active = true };
+            }
+
+            buffer->stopFrame = startFrame + fadeFrames;
+        }
+        else fadeFrames = 0;    // Current stream already ended, next one starts right away
+
+        // Next stream starts from its current position, fading in
+        ma_atomic_store_32(&next->playing, true);
+        ma_atomic_store_32(&next->paused, false);
+        next->startFrame = nextStartFrame;
+        next->stopFrame = AUDIO_CLOCK_NEVER;
+        next->fade = (fadeFrames > 0)? 0.0f : 1.0f;
+        next->fadeRamp = (AudioRamp){ .target = 1.0f, .startFrame = startFrame, .length = fadeFrames, .active = (fadeFrames > 0) };
+        UpdateAudioBufferLevels(next);
+
+        buffer->queued = NULL;
+    }
+}
+
+// Push a command to the mixer commands queue, it will be applied on next mixer period
+// NOTE: Multiple producers are supported, returns a ticket to be used with SyncAudioCommands()
+static ma_uint32 PushAudioCommand(AudioCommand command)
+{
+    while (1)
+    {
+        ma_uint32 position = ma_atomic_load_32(&AUDIO.Command.head);
+        ma_uint32 index = position & (MAX_AUDIO_COMMANDS - 1);
+        AudioCommandCell *cell = &AUDIO.Command.queue[index];
+
+        // Cell sequence is stored relative to cell index, so a zero-initialized queue is valid
+        ma_uint32 sequence = ma_atomic_load_explicit_32(&cell->sequence, ma_atomic_memory_order_acquire) + index;
+
+        if (sequence == position)
+        {
+            if (ma_atomic_compare_exchange_weak_32(&AUDIO.Command.head, &position, position + 1))
+            {
+                cell->command = command;
+                ma_atomic_store_explicit_32(&cell->sequence, position + 1 - index, ma_atomic_memory_order_release);
+
+                return position + 1;
+            }
+        }
+        else if ((ma_int32)(sequence - position) < 0)
+        {
+            // Queue is full, wait for the oldest command to be applied
+            SyncAudioCommands(position - MAX_AUDIO_COMMANDS + 1);
+        }
+    }
+}
+
+// Push an audio buffer state command, tracking the state requested by the program
+// NOTE: Requested state is only reported by IsAudioBufferPlaying(), the mixer never reads it
+static void PushAudioBufferRequest(AudioBuffer *buffer, AudioCommand command, bool playing, bool paused)
+{
+    ma_atomic_store_32(&buffer->requestPlaying, playing);
+    ma_atomic_store_32(&buffer->requestPaused, paused);
+    ma_atomic_store_32(&buffer->requestTicket, PushAudioCommand(command));
+}
+
+// Check if an audio buffer is playing or paused (not stopped), from a program state
+// NOTE: Pause and resume keep the buffer started or stopped, as the mixer does
+static bool IsAudioBufferActive(AudioBuffer *buffer)
+{
+    bool result = false;
+
+    if (IsAudioCommandPending(ma_atomic_load_32(&buffer->requestTicket))) result = ma_atomic_load_32(&buffer->requestPlaying);
+    else result = ma_atomic_load_32(&buffer->playing);
+
+    return result;
+}
+
+// Check if a command is still pending to be applied by the mixer
+// NOTE: Ticket 0 is used for no command, it is never pending until the queue position wraps around
+static bool IsAudioCommandPending(ma_uint32 ticket)
+{
+    return ((ma_int32)(ma_atomic_load_32(&AUDIO.Command.tail) - ticket) < 0);
+}
+
+// Wait until the command identified by ticket (and all previous ones) has been applied
+// NOTE: In case the mixer is not running (device not started, stalled, offline mode or web platform), commands are applied here
+static void SyncAudioCommands(ma_uint32 ticket)
+{
+    if ((ma_int32)(ma_atomic_load_32(&AUDIO.Command.tail) - ticket) >= 0) return;
+
+#if !defined(__EMSCRIPTEN__)
+    if (IsAudioDeviceReady() && !AUDIO.System.isOffline)
+    {
+        // Give the mixer some periods to apply the commands
+        ma_uint32 periodInMilliseconds = (AUDIO.System.periodSize*1000)/AUDIO.System.sampleRate;
+        ma_uint32 timeout = 4*periodInMilliseconds + 10;
+
+        for (ma_uint32 i = 0; i < timeout; i++)
+        {
+            if ((ma_int32)(ma_atomic_load_32(&AUDIO.Command.tail) - ticket) >= 0) return;
+            ma_sleep(1);
+        }
+    }
+#endif
+
+    // Mixer is not running, commands are applied by this thread
+    // NOTE: Another producer could still be writing a previous command, in that case we just yield and retry
+    while ((ma_int32)(ma_atomic_load_32(&AUDIO.Command.tail) - ticket) < 0)
+    {
+        ma_spinlock_lock(&AUDIO.System.mixLock);
+        ProcessAudioCommands();
+        ma_spinlock_unlock(&AUDIO.System.mixLock);
+
+        if ((ma_int32)(ma_atomic_load_32(&AUDIO.Command.tail) - ticket) < 0) ma_yield();
+    }
+}
+
+// Apply all pending commands, assuming the mixer is locked
+// NOTE: Single consumer, commands are applied in the same order they were pushed
+static void ProcessAudioCommands(void)
+{
+    while (1)
+    {
+        ma_uint32 position = AUDIO.Command.tail;
+        ma_uint32 index = position & (MAX_AUDIO_COMMANDS - 1);
+        AudioCommandCell *cell = &AUDIO.Command.queue[index];
+
+        ma_uint32 sequence = ma_atomic_load_explicit_32(&cell->sequence, ma_atomic_memory_order_acquire) + index;
+        if (sequence != (position + 1)) break;  // Queue is empty or next command is still being written
+
+        AudioCommand command = cell->command;
+        ma_atomic_store_explicit_32(&cell->sequence, position + MAX_AUDIO_COMMANDS - index, ma_atomic_memory_order_release);
+
+        ApplyAudioCommand(&command);
+
+        // Tail is updated after applying the command, so SyncAudioCommands() can see its effects
+        ma_atomic_store_explicit_32(&AUDIO.Command.tail, position + 1, ma_atomic_memory_order_release);
+    }
+}
+
+// Apply a command to the mixer state, assuming the mixer is locked
+static void ApplyAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+            else
+            {
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
+            }
+
+            AUDIO.Buffer.last = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        {
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
+
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
+
+            buffer->prev = NULL;
+            buffer->next = NULL;
+
+            // Pending transitions from or to the buffer are cancelled
+            buffer->queued = NULL;
+            for (AudioBuffer *other = AUDIO.Buffer.first; other != NULL; other = other->next)
+            {
+                if (other->queued == buffer) other->queued = NULL;
+            }
+        } break;
+        case AUDIO_COMMAND_PLAY:
+        {
+            ma_atomic_store_32(&buffer->playing, true);
+            ma_atomic_store_32(&buffer->paused, false);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            buffer->startFrame = command->frame;
+            buffer->stopFrame = AUDIO_CLOCK_NEVER;
+            buffer->fade = 1.0f;
+            buffer->fadeRamp.active = false;
+            UpdateAudioBufferLevels(buffer);
+        } break;
+        case AUDIO_COMMAND_STOP: StopAudioBufferInLockedState(buffer); break;
+        case AUDIO_COMMAND_STOP_SCHEDULED: buffer->stopFrame = command->frame; break;
+        case AUDIO_COMMAND_PAUSE: ma_atomic_store_32(&buffer->paused, true); break;
+        case AUDIO_COMMAND_RESUME: ma_atomic_store_32(&buffer->paused, false); break;
+        case AUDIO_COMMAND_SEEK: ma_atomic_store_32(&buffer->frameCursorPos, command->frames); break;
+        case AUDIO_COMMAND_VOLUME:
+        {
+            buffer->volume = command->value;
+            buffer->volumeRamp.active = false;
+            UpdateAudioBufferLevels(buffer);
+        } break;
+        case AUDIO_COMMAND_PAN:
+        {
+            buffer->pan = command->value;
+            buffer->panRamp.active = false;
+            UpdateAudioBufferLevels(buffer);
+        } break;
+        case AUDIO_COMMAND_VOLUME_RAMP:
+        case AUDIO_COMMAND_PAN_RAMP:
+        {
+            float *value = (command->type == AUDIO_COMMAND_VOLUME_RAMP)? &buffer->volume : &buffer->pan;
+            AudioRamp *ramp = (command->type == AUDIO_COMMAND_VOLUME_RAMP)? &buffer->volumeRamp : &buffer->panRamp;
+
+            // A ramp in progress is replaced, new ramp starts from its current value
+            *value = GetAudioRampValue(*value, ramp, ma_atomic_load_64(&AUDIO.System.framesRendered));
+
+            ramp->target = command->value;
+            ramp->startFrame = command->frame;
+            ramp->length = command->frames;
+            ramp->active = true;
+
+            UpdateAudioBufferLevels(buffer);
+        } break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is just an adjustment of the sample rate
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command->value;
+        } break;
+        case AUDIO_COMMAND_RESET:
+        {
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->framesProcessed, command->frames);
+            buffer->framesRead = command->frames;
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+
+            // NOTE: Decoder thread is locked by the program while resetting
+            if (buffer->decoder != NULL) ma_pcm_rb_reset(&buffer->decoder->ring);
+        } break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_DECODER:
+        {
+            buffer->decoder = command->decoder;
+
+            // Sub-buffers data is outdated, they must be refilled by UpdateMusicStream()
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+        } break;
+        case AUDIO_COMMAND_RING: buffer->ring = command->ring; break;
+        case AUDIO_COMMAND_ATTACH_PROCESSOR:
+        case AUDIO_COMMAND_BUS_ATTACH_PROCESSOR:
+        {
+            // Processors are attached to a bus, to the buffer or to the mixed output if no buffer provided
+            rAudioProcessor **first = (command->type == AUDIO_COMMAND_BUS_ATTACH_PROCESSOR)? &AUDIO.buses[command->bus].processor :
+                (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *processor = command->processor;
+
+            if (*first == NULL) *first = processor;
+            else
+            {
+                rAudioProcessor *last = *first;
+                while (last->next != NULL) last = last->next;
+
+                processor->prev = last;
+                last->next = processor;
+            }
+        } break;
+        case AUDIO_COMMAND_DETACH_PROCESSOR:
+        case AUDIO_COMMAND_BUS_DETACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (command->type == AUDIO_COMMAND_BUS_DETACH_PROCESSOR)? &AUDIO.buses[command->bus].processor :
+                (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *processor = *first;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
+
+                if (processor->process == command->callback)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
+
+                    // Memory can not be freed by the mixer, processor is moved to the garbage list
+                    rAudioProcessor *garbage = NULL;
+                    do
+                    {
+                        garbage = (rAudioProcessor *)ma_atomic_load_ptr((void **)&AUDIO.Command.garbage);
+                        processor->next = garbage;
+                    } while (!ma_atomic_compare_exchange_weak_ptr((void **)&AUDIO.Command.garbage, (void **)&garbage, processor));
+                }
+
+                processor = next;
+            }
+        } break;
+        case AUDIO_COMMAND_VOICE_PLAY:
+        {
+            // Voice buffer plays the source data from the start, with source parameters
+            AudioBuffer *source = command->source;
+            AudioVoice *voice = &AUDIO.Voice.pool[command->frames];
+
+            buffer->data = source->data;
+            buffer->compressed = source->compressed;
+            buffer->sizeInFrames = source->sizeInFrames;
+            buffer->looping = source->looping;
+            buffer->bus = source->bus;
+            buffer->volume = source->volume;
+            buffer->pan = source->pan;
+            buffer->pitch = source->pitch;
+            buffer->volumeRamp.active = false;
+            buffer->panRamp.active = false;
+            UpdateAudioBufferLevels(buffer);
+
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, (ma_uint32)((float)buffer->converter.sampleRateOut/buffer->pitch));
+
+            ma_atomic_store_32(&buffer->playing, true);
+            ma_atomic_store_32(&buffer->paused, false);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->framesProcessed, 0);
+            buffer->framesRead = 0;
+            buffer->startFrame = 0;
+            buffer->stopFrame = AUDIO_CLOCK_NEVER;
+
+            ma_atomic_store_f32(&voice->level, buffer->volume);
+
+            if (!voice->active)
+            {
+                voice->active = true;
+                AUDIO.Voice.active[AUDIO.Voice.activeCount] = voice;
+                AUDIO.Voice.activeCount++;
+            }
+        } break;
+        case AUDIO_COMMAND_BUS: buffer->bus = command->bus; break;
+        case AUDIO_COMMAND_BUS_VOLUME: AUDIO.buses[command->bus].volume = command->value; break;
+        case AUDIO_COMMAND_BUS_DUCKING:
+        {
+            AudioBus *bus = &AUDIO.buses[command->bus];
+
+            bus->duckTrigger = (int)command->value;
+            bus->duckAmount = command->values[0];
+            bus->duckAttack = command->values[1];
+            bus->duckRelease = command->values[2];
+            if (bus->duckTrigger < 0) bus->duckLevel = 0.0f;
+        } break;
+        case AUDIO_COMMAND_BUS_ADD_EFFECT:
+        {
+            AudioBus *bus = &AUDIO.buses[command->bus];
+
+            bus->effects[bus->effectCount] = command->effect;
+            bus->effectCount++;
+        } break;
+        case AUDIO_COMMAND_BUS_EFFECT_PARAM:
+        {
+            command->effect->params[command->frames] = command->value;
+            UpdateAudioEffect(command->effect);
+        } break;
+        case AUDIO_COMMAND_BUS_CLEAR_EFFECTS: AUDIO.buses[command->bus].effectCount = 0; break;
+        case AUDIO_COMMAND_QUEUE:
+        {
+            buffer->queued = command->source;
+            buffer->queuedLength = command->frames;
+            buffer->queuedFadeFrames = (ma_uint32)(command->value*(float)AUDIO.System.sampleRate);
+            buffer->queuedGapless = command->flag;
+        } break;
+        default: break;
+    }
+}
+
+// Free processors detached by the mixer
+static void FreeAudioProcessorGarbage(void)
+{
+    rAudioProcessor *processor = (rAudioProcessor *)ma_atomic_exchange_ptr((void **)&AUDIO.Command.garbage, NULL);
+
+    while (processor)
+    {
+        rAudioProcessor *next = processor->next;
+        RL_FREE(processor);
+        processor = next;
+    }
+}
+
+// Free unloaded audio buffers already untracked by the mixer, buffers still tracked are kept for a later call
+// NOTE: Called when loading and unloading sounds, if wait is requested all unloaded buffers are freed
+static void FreeAudioBufferGarbage(bool wait)
+{
+    AudioBuffer *buffer = (AudioBuffer *)ma_atomic_exchange_ptr((void **)&AUDIO.Buffer.unloaded, NULL);
+
+    if (wait && (buffer != NULL)) SyncAudioCommands(ma_atomic_load_32(&AUDIO.Command.head));
+
+    while (buffer != NULL)
+    {
+        AudioBuffer *next = buffer->unloadNext;
+
+        if (IsAudioCommandPending(buffer->unloadTicket))
+        {
+            // Buffer is returned to the list, it could be mixed until untracked
+            AudioBuffer *unloaded = NULL;
+            do
+            {
+                unloaded = (AudioBuffer *)ma_atomic_load_ptr((void **)&AUDIO.Buffer.unloaded);
+                buffer->unloadNext = unloaded;
+            } while (!ma_atomic_compare_exchange_weak_ptr((void **)&AUDIO.Buffer.unloaded, (void **)&unloaded, buffer));
+        }
+        else
+        {
+            ma_data_converter_uninit(&buffer->converter, NULL);
+
+            // Aliases share sound data and compressed data with their source sound
+            if (!buffer->isAlias)
+            {
+                RL_FREE(buffer->data);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+                if (buffer->compressed != NULL)
+                {
+                    RL_FREE(buffer->compressed->data);
+                    RL_FREE(buffer->compressed);
+                }
+#endif
+            }
+
+            RL_FREE(buffer->cursor);
+            RL_FREE(buffer);
+        }
+
+        buffer = next;
+    }
+}
+
+// Build music seek index, assuming the decoder is locked (if any)
+// NOTE: Only MP3 requires an index, seeking scans from the start of the stream otherwise,
+// index scan only parses frame headers, seek points are evenly spaced by MUSIC_SEEK_INDEX_STEP
+static bool BuildMusicSeekIndex(Music music)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    if (music.ctxType == MUSIC_AUDIO_MP3)
+    {
+        drmp3 *ctxMp3 = (drmp3 *)music.ctxData;
+        drmp3_uint32 pointCount = music.frameCount/MUSIC_SEEK_INDEX_STEP + 1;
+        drmp3_seek_point *points = (drmp3_seek_point *)RL_CALLOC(pointCount, sizeof(drmp3_seek_point));
+
+        if (points != NULL)
+        {
+            success = drmp3_calculate_seek_points(ctxMp3, &pointCount, points) && drmp3_bind_seek_table(ctxMp3, pointCount, points);
+
+            if (!success)
+            {
+                RL_FREE(points);
+                TRACELOG(LOG_WARNING, "STREAM: Failed to build music seek index");
+            }
+            else TRACELOG(LOG_DEBUG, "STREAM: Music seek index built (%i seek points)", (int)pointCount);
+        }
+    }
+#endif
+
+    return success;
+}
+
+// Read (decode) music stream frames into provided buffer, from current music context position
+// NOTE: Context is rewound when reaching the end, frames to read should be limited if music is not looping
+static void ReadMusicStreamFrames(Music music, void *pcm, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcm + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcm + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)pcm + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcm + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)pcm, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)pcm + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcm + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)pcm, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)pcm, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+#if !defined(__EMSCRIPTEN__)
+// Music decoder thread, keeps the ring buffer filled with decoded frames
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *userData)
+{
+    MusicDecoder *decoder = (MusicDecoder *)userData;
+
+    while (ma_atomic_load_32(&decoder->running))
+    {
+        ma_mutex_lock(&decoder->lock);
+
+        while (!ma_atomic_load_32(&decoder->finished))
+        {
+            ma_uint32 framesToDecode = ma_pcm_rb_available_write(&decoder->ring);
+            if (framesToDecode == 0) break;
+
+            // Time-stretch is kept running once started, at base tempo it outputs input frames unchanged
+            float tempo = ma_atomic_load_f32(&decoder->music.stream.buffer->tempo);
+
+            if ((decoder->stretch == NULL) && (tempo != 1.0f)) decoder->stretch = LoadMusicStretch(decoder->music);
+
+            if ((decoder->stretch != NULL) && ((tempo != 1.0f) || decoder->stretch->primed))
+            {
+                void *ringBuffer = NULL;
+                ma_pcm_rb_acquire_write(&decoder->ring, &framesToDecode, &ringBuffer);
+
+                framesToDecode = ReadMusicStretchFrames(decoder, tempo, ringBuffer, framesToDecode);
+
+                ma_pcm_rb_commit_write(&decoder->ring, framesToDecode);
+                continue;
+            }
+
+            // Frames to decode must be limited to music end if not looping
+            ma_uint32 framesLeft = decoder->music.frameCount - decoder->framesDecoded;
+            if (!ma_atomic_load_32(&decoder->looping) && (framesToDecode > framesLeft)) framesToDecode = framesLeft;
+
+            // Decoding directly into ring buffer memory, region could be smaller than requested if ring wraps
+            void *ringBuffer = NULL;
+            ma_pcm_rb_acquire_write(&decoder->ring, &framesToDecode, &ringBuffer);
+
+            ReadMusicStreamFrames(decoder->music, ringBuffer, framesToDecode);
+
+            ma_pcm_rb_commit_write(&decoder->ring, framesToDecode);
+
+            decoder->framesDecoded = (decoder->framesDecoded + framesToDecode)%decoder->music.frameCount;
+
+            if (!ma_atomic_load_32(&decoder->looping) && (framesToDecode == framesLeft)) ma_atomic_store_32(&decoder->finished, true);
+        }
+
+        ma_mutex_unlock(&decoder->lock);
+
+        ma_sleep(decoder->sleepTime);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Load music decoder and start its thread
+// NOTE: Decoder starts from current music context position
+static MusicDecoder *LoadMusicDecoder(Music music, unsigned int frames)
+{
+#if defined(__EMSCRIPTEN__)
+    // NOTE: Web audio callback runs on main thread, music must be decoded on UpdateMusicStream()
+    TRACELOG(LOG_WARNING, "STREAM: Music decoder thread not supported on this platform");
+    return NULL;
+#else
+    MusicDecoder *decoder = (MusicDecoder *)RL_CALLOC(1, sizeof(MusicDecoder));
+
+    if (decoder == NULL)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music decoder");
+        return NULL;
+    }
+
+    ma_format format = ((music.stream.sampleSize == 8)? ma_format_u8 : ((music.stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    if (ma_pcm_rb_init(format, music.stream.channels, frames, NULL, NULL, &decoder->ring) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder ring buffer");
+        RL_FREE(decoder);
+        return NULL;
+    }
+
+    if (ma_mutex_init(&decoder->lock) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create mutex for music decoder");
+        ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder);
+        return NULL;
+    }
+
+    decoder->music = music;
+    decoder->framesDecoded = ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount;
+    decoder->looping = music.looping;
+    decoder->running = true;
+
+    // Ring buffer is refilled 4 times per prebuffered time
+    decoder->sleepTime = (frames*1000/music.stream.sampleRate)/4;
+    if (decoder->sleepTime < 1) decoder->sleepTime = 1;
+    else if (decoder->sleepTime > 20) decoder->sleepTime = 20;
+
+    if (ma_thread_create(&decoder->thread, ma_thread_priority_normal, 0, MusicDecoderThread, decoder, NULL) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+        ma_mutex_uninit(&decoder->lock);
+        ma_pcm_rb_uninit(&decoder->ring);
+        RL_FREE(decoder);
+        return NULL;
+    }
+
+    TRACELOG(LOG_INFO, "STREAM: Music decoder thread started (%i frames prebuffer)", frames);
+
+    return decoder;
+#endif
+}
+
+// Stop music decoder thread and unload it
+// NOTE: Mixer must not be using the decoder anymore
+static void UnloadMusicDecoder(MusicDecoder *decoder)
+{
+#if !defined(__EMSCRIPTEN__)
+    if (decoder != NULL)
+    {
+        ma_atomic_store_32(&decoder->running, false);
+        ma_thread_wait(&decoder->thread);
+
+        ma_mutex_uninit(&decoder->lock);
+        ma_pcm_rb_uninit(&decoder->ring);
+        UnloadMusicStretch(decoder->stretch);
+        RL_FREE(decoder);
+    }
+#endif
+}
+
+// Load music time-stretch
+static MusicStretch *LoadMusicStretch(Music music)
+{
+    MusicStretch *stretch = (MusicStretch *)RL_CALLOC(1, sizeof(MusicStretch));
+
+    if (stretch == NULL)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music time-stretch");
+        return NULL;
+    }
+
+    stretch->format = ((music.stream.sampleSize == 8)? ma_format_u8 : ((music.stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    stretch->channels = music.stream.channels;
+    stretch->hop = music.stream.sampleRate*MUSIC_STRETCH_WINDOW_MS/2000;
+    stretch->seek = music.stream.sampleRate*MUSIC_STRETCH_SEEK_MS/1000;
+
+    // Input keeps the frames required by a window, its search range and the next hop at maximum tempo,
+    // plus a decoding chunk (one hop)
+    stretch->capacity = stretch->hop*(3 + (ma_uint32)MUSIC_TEMPO_MAX) + 4*stretch->seek;
+
+    stretch->input = (float *)RL_MALLOC(stretch->capacity*stretch->channels*sizeof(float));
+    stretch->mono = (float *)RL_MALLOC(stretch->capacity*sizeof(float));
+    stretch->overlap = (float *)RL_MALLOC(stretch->hop*stretch->channels*sizeof(float));
+    stretch->output = (float *)RL_MALLOC(stretch->hop*stretch->channels*sizeof(float));
+    stretch->window = (float *)RL_MALLOC(stretch->hop*sizeof(float));
+    stretch->fade = (float *)RL_MALLOC(stretch->hop*sizeof(float));
+    stretch->pcm = RL_MALLOC(stretch->hop*ma_get_bytes_per_frame(stretch->format, stretch->channels));
+
+    if ((stretch->input == NULL) || (stretch->mono == NULL) || (stretch->overlap == NULL) ||
+        (stretch->output == NULL) || (stretch->window == NULL) || (stretch->fade == NULL) || (stretch->pcm == NULL))
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate memory for music time-stretch");
+        UnloadMusicStretch(stretch);
+        return NULL;
+    }
+
+    // Hann window, overlapped halves sum to 1.0f
+    for (ma_uint32 i = 0; i < stretch->hop; i++)
+    {
+        stretch->window[i] = 0.5f - 0.5f*cosf(PI*(float)i/(float)stretch->hop);
+        stretch->fade[i] = 1.0f - stretch->window[i];
+    }
+
+    ResetMusicStretch(stretch);
+
+    return stretch;
+}
+
+// Unload music time-stretch
+static void UnloadMusicStretch(MusicStretch *stretch)
+{
+    if (stretch != NULL)
+    {
+        RL_FREE(stretch->input);
+        RL_FREE(stretch->mono);
+        RL_FREE(stretch->overlap);
+        RL_FREE(stretch->output);
+        RL_FREE(stretch->window);
+        RL_FREE(stretch->fade);
+        RL_FREE(stretch->pcm);
+        RL_FREE(stretch);
+    }
+}
+
+// Reset music time-stretch, input restarts from music current position
+static void ResetMusicStretch(MusicStretch *stretch)
+{
+    stretch->count = 0;
+    stretch->end = 0;
+    stretch->natural = 0;
+    stretch->position = 0.0;
+    stretch->outputCursor = stretch->hop;
+    stretch->primed = false;
+    stretch->ended = false;
+}
+
+// Read time-stretched music frames, decoding music frames as required
+// NOTE: Returns frames written, decoder is flagged as finished once music end has been output (not looping)
+static ma_uint32 ReadMusicStretchFrames(MusicDecoder *decoder, float tempo, void *framesOut, ma_uint32 frameCount)
+{
+    MusicStretch *stretch = decoder->stretch;
+    const ma_uint32 channels = stretch->channels;
+    const ma_uint32 hop = stretch->hop;
+    const ma_uint32 frameSize = ma_get_bytes_per_frame(stretch->format, channels);
+    ma_uint32 framesWritten = 0;
+
+    while (framesWritten < frameCount)
+    {
+        // Output hop frames pending are written first
+        if (stretch->outputCursor < hop)
+        {
+            ma_uint32 framesToWrite = hop - stretch->outputCursor;
+            if (framesToWrite > (frameCount - framesWritten)) framesToWrite = frameCount - framesWritten;
+
+            void *pcm = (unsigned char *)framesOut + framesWritten*frameSize;
+
+            if (stretch->format == ma_format_s16) ConvertAudioSamplesF32ToS16((short *)pcm, stretch->output + stretch->outputCursor*channels, framesToWrite*channels);
+            else ma_pcm_convert(pcm, stretch->format, stretch->output + stretch->outputCursor*channels, ma_format_f32, framesToWrite*channels, ma_dither_mode_none);
+
+            stretch->outputCursor += framesToWrite;
+            framesWritten += framesToWrite;
+            continue;
+        }
+
+        if (stretch->ended && (stretch->natural >= stretch->end))
+        {
+            ma_atomic_store_32(&decoder->finished, true);
+            break;
+        }
+
+        // Window position, at base tempo windows are contiguous and input is output unchanged
+        if (tempo == 1.0f) stretch->position = stretch->natural;
+
+        ma_uint32 nominal = (ma_uint32)(stretch->position + 0.5);
+        ma_uint32 first = (nominal > stretch->seek)? nominal - stretch->seek : 0;
+        ma_uint32 discarded = (stretch->natural < first)? stretch->natural : first;
+
+        // Input frames no longer required are discarded when more space is needed
+        if ((discarded > 0) && ((stretch->count + hop) > stretch->capacity))
+        {
+            memmove(stretch->input, stretch->input + discarded*channels, (stretch->count - discarded)*channels*sizeof(float));
+            memmove(stretch->mono, stretch->mono + discarded, (stretch->count - discarded)*sizeof(float));
+
+            stretch->count -= discarded;
+            stretch->end = (stretch->end > discarded)? stretch->end - discarded : 0;
+            stretch->natural -= discarded;
+            stretch->position -= discarded;
+            nominal -= discarded;
+            first -= discarded;
+        }
+
+        // Input must contain the window search range (refined one frame further) and the continuation of previous window
+        ma_uint32 framesRequired = nominal + stretch->seek + 2*hop + 1;
+        if (framesRequired < (stretch->natural + hop)) framesRequired = stretch->natural + hop;
+
+        if (stretch->count < framesRequired)
+        {
+            ma_uint32 framesToDecode = framesRequired - stretch->count;
+            if (framesToDecode > hop) framesToDecode = hop;
+            if (framesToDecode > (stretch->capacity - stretch->count)) framesToDecode = stretch->capacity - stretch->count;
+
+            if (!stretch->ended)
+            {
+                // Frames to decode must be limited to music end if not looping
+                ma_uint32 framesLeft = decoder->music.frameCount - decoder->framesDecoded;
+                if (!ma_atomic_load_32(&decoder->looping) && (framesToDecode > framesLeft)) framesToDecode = framesLeft;
+
+                ReadMusicStreamFrames(decoder->music, stretch->pcm, framesToDecode);
+                if (stretch->format == ma_format_s16) ConvertAudioSamplesS16ToF32(stretch->input + stretch->count*channels, (const short *)stretch->pcm, framesToDecode*channels);
+                else ma_pcm_convert(stretch->input + stretch->count*channels, ma_format_f32, stretch->pcm, stretch->format, framesToDecode*channels, ma_dither_mode_none);
+
+                decoder->framesDecoded = (decoder->framesDecoded + framesToDecode)%decoder->music.frameCount;
+
+                if (!ma_atomic_load_32(&decoder->looping) && (framesToDecode == framesLeft))
+                {
+                    stretch->ended = true;
+                    stretch->end = stretch->count + framesToDecode;
+                }
+            }
+            else memset(stretch->input + stretch->count*channels, 0, framesToDecode*channels*sizeof(float));
+
+            DownmixAudioFrames(stretch->mono + stretch->count, stretch->input + stretch->count*channels, framesToDecode, channels);
+
+            stretch->count += framesToDecode;
+            continue;
+        }
+
+        // Previous window overlap starts as input first frames, so output starts without fading in
+        if (!stretch->primed)
+        {
+            memcpy(stretch->overlap, stretch->input, hop*channels*sizeof(float));
+            ApplyAudioFrameGains(stretch->overlap, stretch->fade, hop, channels);
+
+            stretch->primed = true;
+        }
+
+        // Window start with the best similarity to previous window continuation, coarse search refined
+        ma_uint32 start = nominal;
+
+        if (tempo != 1.0f)
+        {
+            const float *target = stretch->mono + stretch->natural;
+            float best = -INFINITY;
+
+            for (ma_uint32 i = first; i <= (nominal + stretch->seek); i += 2)
+            {
+                float similarity = GetAudioSamplesDot(stretch->mono + i, target, hop);
+                if (similarity > best) { best = similarity; start = i; }
+            }
+
+            ma_uint32 coarse = start;
+
+            if (coarse > first)
+            {
+                float similarity = GetAudioSamplesDot(stretch->mono + coarse - 1, target, hop);
+                if (similarity > best) { best = similarity; start = coarse - 1; }
+            }
+
+            if (GetAudioSamplesDot(stretch->mono + coarse + 1, target, hop) > best) start = coarse + 1;
+        }
+
+        // Window is overlap-added to previous window second half
+        const float *frames = stretch->input + start*channels;
+
+        OverlapAddAudioFrames(stretch->output, stretch->overlap, frames, frames + hop*channels, stretch->window, stretch->fade, hop, channels);
+
+        stretch->outputCursor = 0;
+        stretch->natural = start + hop;
+        stretch->position += (double)hop*tempo;
+    }
+
+    return framesWritten;
+}
+
+// Init voices pool buffers, they use device format, like sounds
+static void InitAudioVoices(void)
+{
+    AUDIO.Voice.activeCount = 0;
+    AUDIO.Voice.order = 0;
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.pool[i];
+
+        voice->buffer = LoadAudioBufferUntracked(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        voice->source = NULL;
+        voice->id = (unsigned int)i;
+        voice->priority = 0;
+        voice->ticket = 0;
+        voice->level = 0.0f;
+        voice->active = false;
+        voice->reserved = false;
+
+        if (voice->buffer == NULL) TRACELOG(LOG_WARNING, "AUDIO: Failed to create voice buffer");
+    }
+}
+
+// Unload voices pool buffers
+// NOTE: Voices data is shared with sounds, only voice buffers are freed
+static void UnloadAudioVoices(void)
+{
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.pool[i];
+
+        if (voice->buffer != NULL)
+        {
+            ma_data_converter_uninit(&voice->buffer->converter, NULL);
+            RL_FREE(voice->buffer->cursor);
+            RL_FREE(voice->buffer);
+            voice->buffer = NULL;
+        }
+
+        voice->source = NULL;
+        voice->active = false;
+        voice->reserved = false;
+    }
+
+    AUDIO.Voice.activeCount = 0;
+}
+
+// Stop all voices playing a sound buffer
+// NOTE: Required before unloading a sound, voices share its data, mixer applies
+// the stop commands before untracking the sound, so its data is not read anymore
+static void StopAudioVoices(AudioBuffer *source)
+{
+    if (!AUDIO.System.isReady || (source == NULL)) return;
+
+    ma_spinlock_lock(&AUDIO.Voice.lock);
+
+    for (int i = 0; i < MAX_AUDIO_VOICES; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.pool[i];
+
+        if ((voice->buffer != NULL) && (voice->source == source))
+        {
+            StopAudioBuffer(voice->buffer);
+            voice->source = NULL;
+        }
+    }
+
+    ma_spinlock_unlock(&AUDIO.Voice.lock);
+}
+
+// Get voice playing a sound instance, assuming voices pool is locked
+// NOTE: Returns NULL if instance is not valid anymore (voice stopped or stolen) or not started yet (voice reserved)
+static AudioVoice *GetAudioVoice(unsigned int instance)
+{
+    AudioVoice *voice = NULL;
+    unsigned int index = instance & 0xffff;
+
+    if ((instance != 0) && (index < MAX_AUDIO_VOICES))
+    {
+        voice = &AUDIO.Voice.pool[index];
+        if ((voice->id != instance) || (voice->source == NULL) || (voice->buffer == NULL) || voice->reserved) voice = NULL;
+    }
+
+    return voice;
+}
+
+// Check if a voice is playing (or pending to play), assuming voices pool is locked
+static bool IsAudioVoiceBusy(AudioVoice *voice, ma_uint32 tail)
+{
+    if ((voice->source == NULL) || (voice->buffer == NULL)) return false;
+
+    // Play command not yet pushed or not yet applied by the mixer
+    if (voice->reserved || ((ma_int32)(tail - voice->ticket) < 0)) return true;
+
+    return ma_atomic_load_32(&voice->buffer->playing);
+}
+
+// Publish playhead anchor, only the mixer writes anchors
+static void WriteAudioPlayhead(AudioPlayhead *playhead, ma_uint64 clock, ma_uint64 position, float rate)
+{
+    ma_uint32 sequence = playhead->sequence;
+
+    ma_atomic_store_32(&playhead->sequence, sequence + 1);
+    ma_atomic_store_64(&playhead->clock, clock);
+    ma_atomic_store_64(&playhead->position, position);
+    ma_atomic_store_f32(&playhead->rate, rate);
+    ma_atomic_store_32(&playhead->sequence, sequence + 2);
+}
+
+// Read playhead anchor, retrying if the mixer is writing it
+static void ReadAudioPlayhead(AudioPlayhead *playhead, ma_uint64 *clock, ma_uint64 *position, float *rate)
+{
+    while (1)
+    {
+        ma_uint32 sequence = ma_atomic_load_32(&playhead->sequence);
+
+        if ((sequence & 1) == 0)
+        {
+            *clock = ma_atomic_load_64(&playhead->clock);
+            *position = ma_atomic_load_64(&playhead->position);
+            *rate = ma_atomic_load_f32(&playhead->rate);
+
+            if (ma_atomic_load_32(&playhead->sequence) == sequence) break;
+        }
+
+        ma_yield();
+    }
+}
+
+// Get audio clock frame being output by the device
+// NOTE: Clock is interpolated from last period start time, up to one period, and delayed by the
+// device latency, offline rendering has no latency so the clock is just the frames rendered
+static double GetAudioOutputClock(void)
+{
+    if (!AUDIO.System.isReady || AUDIO.System.isOffline) return (double)ma_atomic_load_64(&AUDIO.System.framesRendered);
+
+    ma_uint64 clock = 0;
+    ma_uint64 time = 0;
+    float rate = 0.0f;
+    ReadAudioPlayhead(&AUDIO.System.output, &clock, &time, &rate);
+
+    if (time == 0) return 0.0;
+
+    double elapsed = (ma_timer_get_time_in_seconds(&AUDIO.System.timer) - (double)time/1000000000.0)*(double)AUDIO.System.sampleRate;
+
+    if (elapsed < 0.0) elapsed = 0.0;
+    else if (elapsed > (double)AUDIO.System.periodSize) elapsed = (double)AUDIO.System.periodSize;
+
+    return (double)clock + elapsed - (double)GetAudioOutputLatencyFrames();
+}
+
+// Get music source frame being output by the device, wrapped to music length
+static double GetMusicPlayheadPosition(Music music)
+{
+    if (music.stream.buffer == NULL) return 0.0;
+
+    ma_uint64 clock = 0;
+    ma_uint64 frame = 0;
+    float rate = 0.0f;
+    ReadAudioPlayhead(&music.stream.buffer->playhead, &clock, &frame, &rate);
+
+    // Playhead advances from the anchor (or goes back to it) at the stream rate
+    double position = (double)frame + (GetAudioOutputClock() - (double)clock)*(double)rate;
+
+    if (position < 0.0) position = 0.0;
+    if (music.frameCount > 0) position = fmod(position, (double)music.frameCount);
+
+    return position;
+}
+
+// Init audio buses default state: full volume, no ducking, no effects
+static void InitAudioBuses(void)
+{
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &AUDIO.buses[i];
+
+        bus->active = false;
+        bus->peak = 0.0f;
+        bus->volume = 1.0f;
+        bus->gain = 1.0f;
+        bus->duckTrigger = -1;
+        bus->duckAmount = 0.0f;
+        bus->duckLevel = 0.0f;
+        bus->effectCount = 0;
+        bus->processor = NULL;
+        bus->loadedCount = 0;
+    }
+}
+
+// Unload audio buses effects and processors, mixer is already stopped
+static void UnloadAudioBuses(void)
+{
+    for (int i = 0; i < MAX_AUDIO_BUSES; i++)
+    {
+        AudioBus *bus = &AUDIO.buses[i];
+
+        for (int e = 0; e < bus->loadedCount; e++) UnloadAudioEffect(bus->loaded[e]);
+        bus->loadedCount = 0;
+        bus->effectCount = 0;
+
+        rAudioProcessor *processor = bus->processor;
+        while (processor)
+        {
+            rAudioProcessor *next = processor->next;
+            RL_FREE(processor);
+            processor = next;
+        }
+
+        bus->processor = NULL;
+    }
+}
+
+// Get bus mixing buffer for current chunk, assuming the mixer is locked
+// NOTE: Bus buffer is cleared the first time it is requested on a chunk
+static float *GetAudioBusFrames(int bus, ma_uint32 frameCount)
+{
+    AudioBus *audioBus = &AUDIO.buses[bus];
+
+    if (!audioBus->active)
+    {
+        memset(audioBus->frames, 0, frameCount*AUDIO.System.channels*sizeof(float));
+        audioBus->active = true;
+    }
+
+    return audioBus->frames;
+}
+
+// Load bus effect with default parameters
+// NOTE: Reverb delay lines are sized for the device sample rate
+static AudioEffect *LoadAudioEffect(int type)
+{
+    AudioEffect *effect = (AudioEffect *)RL_CALLOC(1, sizeof(AudioEffect));
+
+    if (effect == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for bus effect");
+        return NULL;
+    }
+
+    effect->type = type;
+
+    switch (type)
+    {
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        case AUDIO_EFFECT_BANDPASS:
+        {
+            effect->params[0] = 1000.0f;    // Cutoff/center frequency (Hz)
+            effect->params[1] = 0.7071f;    // Resonance (Q)
+        } break;
+        case AUDIO_EFFECT_COMPRESSOR:
+        {
+            effect->params[0] = -18.0f;     // Threshold (dB)
+            effect->params[1] = 4.0f;       // Ratio
+            effect->params[2] = 10.0f;      // Attack (ms)
+            effect->params[3] = 100.0f;     // Release (ms)
+        } break;
+        case AUDIO_EFFECT_LIMITER:
+        {
+            effect->params[0] = -1.0f;      // Ceiling (dB)
+            effect->params[1] = 50.0f;      // Release (ms)
+        } break;
+        case AUDIO_EFFECT_REVERB:
+        {
+            effect->params[0] = 0.5f;       // Room size
+            effect->params[1] = 0.5f;       // Damping
+            effect->params[2] = 0.25f;      // Wet level
+
+            // Freeverb tunings at 44100 Hz, right channel lines are spread to decorrelate channels
+            static const int combTuning[4] = { 1116, 1188, 1277, 1356 };
+            static const int allpassTuning[2] = { 556, 441 };
+            const float scale = (float)AUDIO.System.sampleRate/44100.0f;
+            int totalLength = 0;
+
+            for (int c = 0; c < 2; c++)
+            {
+                for (int k = 0; k < 4; k++) effect->lineLength[c*4 + k] = (int)((float)(combTuning[k] + c*23)*scale) + 1;
+                for (int k = 0; k < 2; k++) effect->lineLength[8 + c*2 + k] = (int)((float)(allpassTuning[k] + c*23)*scale) + 1;
+            }
+
+            for (int i = 0; i < AUDIO_EFFECT_REVERB_LINES; i++) totalLength += effect->lineLength[i];
+
+            float *lines = (float *)RL_CALLOC(totalLength, sizeof(float));
+
+            if (lines == NULL)
+            {
+                TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for reverb delay lines");
+                RL_FREE(effect);
+                return NULL;
+            }
+
+            for (int i = 0; i < AUDIO_EFFECT_REVERB_LINES; i++)
+            {
+                effect->lines[i] = lines;
+                lines += effect->lineLength[i];
+            }
+        } break;
+        default: break;
+    }
+
+    UpdateAudioEffect(effect);
+
+    return effect;
+}
+
+// Unload bus effect
+static void UnloadAudioEffect(AudioEffect *effect)
+{
+    if (effect == NULL) return;
+
+    RL_FREE(effect->lines[0]);
+    RL_FREE(effect);
+}
+
+// Update effect coefficients from parameters
+// NOTE: Called by the program on load and by the mixer on parameters change
+static void UpdateAudioEffect(AudioEffect *effect)
+{
+    const float sampleRate = (float)AUDIO.System.sampleRate;
+
+    switch (effect->type)
+    {
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        case AUDIO_EFFECT_BANDPASS:
+        {
+            // Biquad coefficients, Audio EQ Cookbook (R. Bristow-Johnson), normalized by a0
+            float frequency = effect->params[0];
+            float q = (effect->params[1] > 0.01f)? effect->params[1] : 0.01f;
+
+            if (frequency < 10.0f) frequency = 10.0f;
+            else if (frequency > sampleRate*0.49f) frequency = sampleRate*0.49f;
+
+            float w0 = 2.0f*PI*frequency/sampleRate;
+            float cosw0 = cosf(w0);
+            float alpha = sinf(w0)/(2.0f*q);
+            float a0 = 1.0f + alpha;
+            float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+
+            if (effect->type == AUDIO_EFFECT_LOWPASS)
+            {
+                b0 = (1.0f - cosw0)*0.5f;
+                b1 = 1.0f - cosw0;
+                b2 = b0;
+            }
+            else if (effect->type == AUDIO_EFFECT_HIGHPASS)
+            {
+                b0 = (1.0f + cosw0)*0.5f;
+                b1 = -(1.0f + cosw0);
+                b2 = b0;
+            }
+            else
+            {
+                // Constant 0 dB peak gain
+                b0 = alpha;
+                b1 = 0.0f;
+                b2 = -alpha;
+            }
+
+            effect->coeffs[0] = b0/a0;
+            effect->coeffs[1] = b1/a0;
+            effect->coeffs[2] = b2/a0;
+            effect->coeffs[3] = (-2.0f*cosw0)/a0;
+            effect->coeffs[4] = (1.0f - alpha)/a0;
+        } break;
+        case AUDIO_EFFECT_COMPRESSOR:
+        case AUDIO_EFFECT_LIMITER:
+        {
+            // Coefficients: threshold (linear), gain exponent over threshold, attack and release smoothing
+            // NOTE: Limiter has infinite ratio and instant attack, output never exceeds ceiling
+            bool limiter = (effect->type == AUDIO_EFFECT_LIMITER);
+            float ratio = limiter? 0.0f : ((effect->params[1] > 1.0f)? effect->params[1] : 1.0f);
+            float attack = limiter? 0.0f : effect->params[2];
+            float release = limiter? effect->params[1] : effect->params[3];
+
+            effect->coeffs[0] = powf(10.0f, effect->params[0]/20.0f);
+            effect->coeffs[1] = limiter? -1.0f : (1.0f/ratio - 1.0f);
+            effect->coeffs[2] = (attack > 0.0f)? expf(-1000.0f/(attack*sampleRate)) : 0.0f;
+            effect->coeffs[3] = (release > 0.0f)? expf(-1000.0f/(release*sampleRate)) : 0.0f;
+        } break;
+        case AUDIO_EFFECT_REVERB:
+        {
+            // Coefficients: comb feedback, comb damping, wet and dry levels
+            float room = (effect->params[0] < 0.0f)? 0.0f : (effect->params[0] > 1.0f)? 1.0f : effect->params[0];
+            float damping = (effect->params[1] < 0.0f)? 0.0f : (effect->params[1] > 1.0f)? 1.0f : effect->params[1];
+            float wet = (effect->params[2] < 0.0f)? 0.0f : (effect->params[2] > 1.0f)? 1.0f : effect->params[2];
+
+            effect->coeffs[0] = 0.7f + room*0.28f;
+            effect->coeffs[1] = damping*0.4f;
+            effect->coeffs[2] = wet*3.0f;
+            effect->coeffs[3] = 1.0f - wet;
+        } break;
+        default: break;
+    }
+}
+
+// Apply effect to bus frames, assuming the mixer is locked
+static void ApplyAudioEffect(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels)
+{
+    // Effects state is kept for up to two channels
+    if (channels > 2) return;
+
+    switch (effect->type)
+    {
+        case AUDIO_EFFECT_LOWPASS:
+        case AUDIO_EFFECT_HIGHPASS:
+        case AUDIO_EFFECT_BANDPASS: ApplyAudioBiquad(effect, frames, frameCount, channels); break;
+        case AUDIO_EFFECT_COMPRESSOR:
+        case AUDIO_EFFECT_LIMITER: ApplyAudioCompressor(effect, frames, frameCount, channels); break;
+        case AUDIO_EFFECT_REVERB: ApplyAudioReverb(effect, frames, frameCount, channels); break;
+        default: break;
+    }
+}
+
+// Apply biquad filter (transposed direct form II)
+// NOTE: Stereo frames are filtered on two SIMD lanes, both channels at once
+static void ApplyAudioBiquad(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels)
+{
+    const float b0 = effect->coeffs[0];
+    const float b1 = effect->coeffs[1];
+    const float b2 = effect->coeffs[2];
+    const float a1 = effect->coeffs[3];
+    const float a2 = effect->coeffs[4];
+    float *z1 = effect->state;
+    float *z2 = effect->state + 2;
+
+#if defined(RAUDIO_SIMD_AVX2) || defined(RAUDIO_SIMD_SSE2)
+    if (channels == 2)
+    {
+        const __m128 vb0 = _mm_set1_ps(b0);
+        const __m128 vb1 = _mm_set1_ps(b1);
+        const __m128 vb2 = _mm_set1_ps(b2);
+        const __m128 va1 = _mm_set1_ps(a1);
+        const __m128 va2 = _mm_set1_ps(a2);
+        __m128 s1 = _mm_setr_ps(z1[0], z1[1], 0.0f, 0.0f);
+        __m128 s2 = _mm_setr_ps(z2[0], z2[1], 0.0f, 0.0f);
+
+        for (ma_uint32 f = 0; f < frameCount; f++)
+        {
+            __m128 x = _mm_castpd_ps(_mm_load_sd((const double *)(frames + f*2)));
+            __m128 y = _mm_add_ps(_mm_mul_ps(vb0, x), s1);
+            s1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vb1, x), _mm_mul_ps(va1, y)), s2);
+            s2 = _mm_sub_ps(_mm_mul_ps(vb2, x), _mm_mul_ps(va2, y));
+            _mm_store_sd((double *)(frames + f*2), _mm_castps_pd(y));
+        }
+
+        float state[4] = { 0 };
+        _mm_storeu_ps(state, s1);
+        z1[0] = state[0];
+        z1[1] = state[1];
+        _mm_storeu_ps(state, s2);
+        z2[0] = state[0];
+        z2[1] = state[1];
+        return;
+    }
+#elif defined(RAUDIO_SIMD_NEON)
+    if (channels == 2)
+    {
+        const float32x2_t vb0 = vdup_n_f32(b0);
+        const float32x2_t vb1 = vdup_n_f32(b1);
+        const float32x2_t vb2 = vdup_n_f32(b2);
+        const float32x2_t va1 = vdup_n_f32(a1);
+        const float32x2_t va2 = vdup_n_f32(a2);
+        float32x2_t s1 = vld1_f32(z1);
+        float32x2_t s2 = vld1_f32(z2);
+
+        for (ma_uint32 f = 0; f < frameCount; f++)
+        {
+            float32x2_t x = vld1_f32(frames + f*2);
+            float32x2_t y = vmla_f32(s1, vb0, x);
+            s1 = vmls_f32(vmla_f32(s2, vb1, x), va1, y);
+            s2 = vmls_f32(vmul_f32(vb2, x), va2, y);
+            vst1_f32(frames + f*2, y);
+        }
+
+        vst1_f32(z1, s1);
+        vst1_f32(z2, s2);
+        return;
+    }
+#endif
+
+    for (ma_uint32 c = 0; c < channels; c++)
+    {
+        float s1 = z1[c];
+        float s2 = z2[c];
+
+        for (ma_uint32 f = 0; f < frameCount; f++)
+        {
+            float x = frames[f*channels + c];
+            float y = b0*x + s1;
+            s1 = b1*x - a1*y + s2;
+            s2 = b2*x - a2*y;
+            frames[f*channels + c] = y;
+        }
+
+        z1[c] = s1;
+        z2[c] = s2;
+    }
+}
+
+// Apply compressor or limiter, stereo linked
+// NOTE: Envelope follows frames peak level, computed gains are applied to all channels at once
+static void ApplyAudioCompressor(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels)
+{
+    float gains[AUDIO_BUS_FRAMES] = { 0 };
+    const float threshold = effect->coeffs[0];
+    const float exponent = effect->coeffs[1];
+    const float attack = effect->coeffs[2];
+    const float release = effect->coeffs[3];
+    float envelope = effect->envelope;
+
+    for (ma_uint32 f = 0; f < frameCount; f++)
+    {
+        float peak = 0.0f;
+        for (ma_uint32 c = 0; c < channels; c++)
+        {
+            float value = fabsf(frames[f*channels + c]);
+            if (value > peak) peak = value;
+        }
+
+        float coeff = (peak > envelope)? attack : release;
+        envelope = peak + coeff*(envelope - peak);
+
+        gains[f] = (envelope > threshold)? powf(envelope/threshold, exponent) : 1.0f;
+    }
+
+    effect->envelope = envelope;
+
+    ApplyAudioFrameGains(frames, gains, frameCount, channels);
+}
+
+// Apply reverb, Freeverb model (J. Smith, Jezar) with 4 parallel comb filters and 2 serial allpass filters per channel
+// NOTE: Delay lines feedback is serial per sample, it is processed without SIMD
+static void ApplyAudioReverb(AudioEffect *effect, float *frames, ma_uint32 frameCount, ma_uint32 channels)
+{
+    const float feedback = effect->coeffs[0];
+    const float damping = effect->coeffs[1];
+    const float wet = effect->coeffs[2];
+    const float dry = effect->coeffs[3];
+
+    for (ma_uint32 f = 0; f < frameCount; f++)
+    {
+        float *frame = frames + f*channels;
+        float input = (channels == 2)? (frame[0] + frame[1])*0.5f : frame[0];
+        input *= 0.03f;
+
+        for (ma_uint32 c = 0; c < channels; c++)
+        {
+            float output = 0.0f;
+
+            for (int k = 0; k < 4; k++)
+            {
+                int line = c*4 + k;
+                float *delay = effect->lines[line] + effect->lineIndex[line];
+                float value = *delay;
+
+                effect->damping[line] = value*(1.0f - damping) + effect->damping[line]*damping;
+                *delay = input + effect->damping[line]*feedback;
+                output += value;
+
+                if (++effect->lineIndex[line] >= effect->lineLength[line]) effect->lineIndex[line] = 0;
+            }
+
+            for (int k = 0; k < 2; k++)
+            {
+                int line = 8 + c*2 + k;
+                float *delay = effect->lines[line] + effect->lineIndex[line];
+                float value = *delay;
+
+                *delay = output + value*0.5f;
+                output = value - output;
+
+                if (++effect->lineIndex[line] >= effect->lineLength[line]) effect->lineIndex[line] = 0;
+            }
+
+            frame[c] = frame[c]*dry + output*wet;
+        }
+    }
+}
+
+// Init FFT tables: analysis window (Hann), twiddles and bit-reversal permutation
+// NOTE: Twiddles for every stage are stored contiguously, stage of size 2*m uses [m, 2*m)
+static void InitAudioFFTTables(float *window, float *twiddleRe, float *twiddleIm, int *bitReverse)
+{
+    int bits = 0;
+    while ((1 << bits) < AUDIO_ANALYSIS_FFT_SIZE) bits++;
+
+    for (int i = 0; i < AUDIO_ANALYSIS_FFT_SIZE; i++)
+    {
+        int reversed = 0;
+        for (int b = 0; b < bits; b++) if (i & (1 << b)) reversed |= 1 << (bits - 1 - b);
+        bitReverse[i] = reversed;
+
+        window[i] = 0.5f - 0.5f*cosf(2.0f*PI*(float)i/(float)AUDIO_ANALYSIS_FFT_SIZE);
+    }
+
+    twiddleRe[0] = 1.0f;
+    twiddleIm[0] = 0.0f;
+
+    for (int m = 1; m < AUDIO_ANALYSIS_FFT_SIZE; m *= 2)
+    {
+        for (int j = 0; j < m; j++)
+        {
+            twiddleRe[m + j] = cosf(-PI*(float)j/(float)m);
+            twiddleIm[m + j] = sinf(-PI*(float)j/(float)m);
+        }
+    }
+}
+
+// Compute in-place complex FFT of AUDIO_ANALYSIS_FFT_SIZE values (radix-2, decimation in time)
+// NOTE: Split real/imaginary arrays and contiguous twiddles per stage let butterflies be vectorized
+static void ComputeAudioFFT(float *re, float *im, const float *twiddleRe, const float *twiddleIm, const int *bitReverse)
+{
+    for (int i = 0; i < AUDIO_ANALYSIS_FFT_SIZE; i++)
+    {
+        int j = bitReverse[i];
+
+        if (j > i)
+        {
+            float tmp = re[i]; re[i] = re[j]; re[j] = tmp;
+            tmp = im[i]; im[i] = im[j]; im[j] = tmp;
+        }
+    }
+
+    for (int m = 1; m < AUDIO_ANALYSIS_FFT_SIZE; m *= 2)
+    {
+        const float *wr = twiddleRe + m;
+        const float *wi = twiddleIm + m;
+
+        for (int k = 0; k < AUDIO_ANALYSIS_FFT_SIZE; k += 2*m)
+        {
+            float *aRe = re + k, *aIm = im + k;
+            float *bRe = re + k + m, *bIm = im + k + m;
+            int j = 0;
+
+#if defined(RAUDIO_SIMD_AVX2)
+            for (; (j + 8) <= m; j += 8)
+            {
+                __m256 xr = _mm256_loadu_ps(bRe + j), xi = _mm256_loadu_ps(bIm + j);
+                __m256 cr = _mm256_loadu_ps(wr + j), ci = _mm256_loadu_ps(wi + j);
+                __m256 tr = _mm256_sub_ps(_mm256_mul_ps(xr, cr), _mm256_mul_ps(xi, ci));
+                __m256 ti = _mm256_add_ps(_mm256_mul_ps(xr, ci), _mm256_mul_ps(xi, cr));
+                __m256 ar = _mm256_loadu_ps(aRe + j), ai = _mm256_loadu_ps(aIm + j);
+                _mm256_storeu_ps(bRe + j, _mm256_sub_ps(ar, tr));
+                _mm256_storeu_ps(bIm + j, _mm256_sub_ps(ai, ti));
+                _mm256_storeu_ps(aRe + j, _mm256_add_ps(ar, tr));
+                _mm256_storeu_ps(aIm + j, _mm256_add_ps(ai, ti));
+            }
+#elif defined(RAUDIO_SIMD_SSE2)
+            for (; (j + 4) <= m; j += 4)
+            {
+                __m128 xr = _mm_loadu_ps(bRe + j), xi = _mm_loadu_ps(bIm + j);
+                __m128 cr = _mm_loadu_ps(wr + j), ci = _mm_loadu_ps(wi + j);
+                __m128 tr = _mm_sub_ps(_mm_mul_ps(xr, cr), _mm_mul_ps(xi, ci));
+                __m128 ti = _mm_add_ps(_mm_mul_ps(xr, ci), _mm_mul_ps(xi, cr));
+                __m128 ar = _mm_loadu_ps(aRe + j), ai = _mm_loadu_ps(aIm + j);
+                _mm_storeu_ps(bRe + j, _mm_sub_ps(ar, tr));
+                _mm_storeu_ps(bIm + j, _mm_sub_ps(ai, ti));
+                _mm_storeu_ps(aRe + j, _mm_add_ps(ar, tr));
+                _mm_storeu_ps(aIm + j, _mm_add_ps(ai, ti));
+            }
+#elif defined(RAUDIO_SIMD_NEON)
+            for (; (j + 4) <= m; j += 4)
+            {
+                float32x4_t xr = vld1q_f32(bRe + j), xi = vld1q_f32(bIm + j);
+                float32x4_t cr = vld1q_f32(wr + j), ci = vld1q_f32(wi + j);
+                float32x4_t tr = vmlsq_f32(vmulq_f32(xr, cr), xi, ci);
+                float32x4_t ti = vmlaq_f32(vmulq_f32(xr, ci), xi, cr);
+                float32x4_t ar = vld1q_f32(aRe + j), ai = vld1q_f32(aIm + j);
+                vst1q_f32(bRe + j, vsubq_f32(ar, tr));
+                vst1q_f32(bIm + j, vsubq_f32(ai, ti));
+                vst1q_f32(aRe + j, vaddq_f32(ar, tr));
+                vst1q_f32(aIm + j, vaddq_f32(ai, ti));
+            }
+#endif
+            for (; j < m; j++)
+            {
+                float tr = bRe[j]*wr[j] - bIm[j]*wi[j];
+                float ti = bRe[j]*wi[j] + bIm[j]*wr[j];
+                bRe[j] = aRe[j] - tr;
+                bIm[j] = aIm[j] - ti;
+                aRe[j] += tr;
+                aIm[j] += ti;
+            }
+        }
+    }
+}
+
+// Compute spectral flux for a range of analysis windows
+// NOTE: Flux is the sum of log-magnitude increases from previous window, window previous
+// to the first one of the range is computed again so ranges can be processed independently
+static void ComputeWaveFlux(WaveFluxTask *task)
+{
+    const int bins = AUDIO_ANALYSIS_FFT_SIZE/2 + 1;
+
+    float *re = (float *)RL_MALLOC(AUDIO_ANALYSIS_FFT_SIZE*sizeof(float));
+    float *im = (float *)RL_MALLOC(AUDIO_ANALYSIS_FFT_SIZE*sizeof(float));
+    float *magnitude = (float *)RL_CALLOC(bins, sizeof(float));
+
+    for (int w = ((task->first > 0)? task->first - 1 : 0); w < task->last; w++)
+    {
+        const float *samples = task->samples + (size_t)w*AUDIO_ANALYSIS_HOP_SIZE;
+
+        for (int i = 0; i < AUDIO_ANALYSIS_FFT_SIZE; i++)
+        {
+            re[i] = samples[i]*task->window[i];
+            im[i] = 0.0f;
+        }
+
+        ComputeAudioFFT(re, im, task->twiddleRe, task->twiddleIm, task->bitReverse);
+
+        float flux = 0.0f;
+
+        for (int k = 0; k < bins; k++)
+        {
+            float value = logf(1.0f + 100.0f*sqrtf(re[k]*re[k] + im[k]*im[k]));
+            if (value > magnitude[k]) flux += value - magnitude[k];
+            magnitude[k] = value;
+        }
+
+        if (w >= task->first) task->flux[w] = (w > 0)? flux : 0.0f;
+    }
+
+    RL_FREE(magnitude);
+    RL_FREE(im);
+    RL_FREE(re);
+}
+
+#if !defined(__EMSCRIPTEN__)
+// Wave spectral flux thread, processes a task range
+static ma_thread_result MA_THREADCALL WaveFluxThread(void *userData)
+{
+    ComputeWaveFlux((WaveFluxTask *)userData);
+
+    return (ma_thread_result)0;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -486,6 +486,54 @@ typedef struct Music {
     void *ctxData;              // Audio context data, depends on type
 } Music;
 
+// AudioDeviceConfig, audio device initialization parameters
+typedef struct AudioDeviceConfig {
+    unsigned int sampleRate;    // Device sample rate (0 for device default)
+    unsigned int periodFrames;  // Device period size in frames (0 for backend default)
+    unsigned int periodCount;   // Device number of periods (0 for backend default)
+    int performanceProfile;     // Device performance profile (AudioPerformanceProfile)
+    int shareMode;              // Device share mode (AudioShareMode)
+    bool offline;               // Offline mode, no device used, mixer driven by RenderAudioFrames()
+} AudioDeviceConfig;
+
+// WaveRhythm, wave rhythm analysis data
+typedef struct WaveRhythm {
+    float tempo;                // Tempo estimated (beats per minute), 0 if not detected
+    float confidence;           // Tempo confidence [0..1] (normalized onset envelope autocorrelation)
+    float beatOffset;           // Beat grid phase, time of first beat (seconds)
+    int onsetCount;             // Number of onsets detected
+    float *onsets;              // Onsets time (seconds)
+    float *onsetStrengths;      // Onsets strength (normalized spectral flux) [0..1]
+    int beatCount;              // Number of beats in grid
+    float *beats;               // Beat grid time (seconds)
+} WaveRhythm;
+
+// AudioStats, audio memory and mixer stats
+typedef struct AudioStats {
+    unsigned int soundCount;            // Number of sounds loaded (aliases not included)
+    unsigned long long soundMemory;     // Sounds data memory, device format data or compressed data (bytes)
+    unsigned long long framesDirect;    // Frames mixed without conversion, straight from sound data or decoded (compressed sounds)
+    unsigned long long framesConverted; // Frames mixed through data converter (pitched sounds and streams)
+    unsigned int compressedCount;       // Number of compressed sounds loaded (included in soundCount)
+    unsigned long long compressedMemory; // Compressed sounds encoded data memory (bytes, included in soundMemory)
+    unsigned long long compressedSaved; // Memory saved by compressed sounds, compared to loading them with LoadSound() (bytes)
+    unsigned long long framesDecoded;   // Frames decoded on demand from compressed sounds
+    double decodeTime;                  // Mixer time spent decoding compressed sounds (seconds)
+    unsigned long long callbackCount;   // Mixer callbacks (device periods) mixed
+    float callbackTimeAvg;              // Mixer callback average duration (seconds)
+    float callbackTimeMax;              // Mixer callback maximum duration (seconds)
+    float callbackTimeP95;              // Mixer callback duration 95th percentile (seconds, approximate)
+    float callbackTimeP99;              // Mixer callback duration 99th percentile (seconds, approximate)
+    float callbackLoad;                 // Mixer callback average load, fraction of the period duration
+    float callbackLoadMax;              // Mixer callback maximum load, fraction of the period duration
+    float processorTime;                // Processors average time per mixer callback (seconds, included in callback time)
+    unsigned int activeVoices;          // Sources mixed on last callback: sounds, sound instances and streams
+    unsigned int activeResamplers;      // Sources mixed on last callback through data converter (resampling, pitch, format)
+    unsigned int deadlineMisses;        // Mixer callbacks longer than their period duration
+    unsigned int xruns;                 // Device periods output as silence or mixer callbacks started late (approximate)
+    unsigned int streamUnderruns;       // Stream reads short of frames: music decoders and pushed frames rings
+} AudioStats;
+
 // VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -527,11 +575,62 @@ typedef struct AutomationEvent {
 
 // Automation event list
 typedef struct AutomationEventList {
-    unsigned int capacity;          // Events max entries (MAX_AUTOMATION_EVENTS)
+    unsigned int capacity;          // Events entries allocated, grows as required on recording
     unsigned int count;             // Events entries count
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Input event, key/button/touch transition registered with its timestamp
+typedef struct InputEvent {
+    unsigned long long timestamp;   // Event time in nanoseconds (GetTime() base), as close as possible to the OS event
+    int type;                       // Event type (InputEventType)
+    int device;                     // Event device: gamepad index or touch point index (0 for keyboard and mouse)
+    int code;                       // Event code: key (KeyboardKey), mouse button (MouseButton), gamepad button (GamepadButton) or touch point id
+    bool pressed;                   // Event transition: pressed or touch down (true), released or touch up (false)
+    Vector2 position;               // Mouse or touch point position when event was registered
+} InputEvent;
+
+// Frame timing, measured by EndDrawing()
+typedef struct FrameTiming {
+    float update;                   // Update time, from previous frame end to BeginDrawing() (seconds)
+    float draw;                     // Draw time, from BeginDrawing() to buffers swap (seconds)
+    float swap;                     // Buffers swap time, including vsync wait (seconds)
+    float wait;                     // Wait time for target frame time (seconds)
+    float frame;                    // Total frame time (seconds)
+} FrameTiming;
+
+// Frame times stats over frame stats window
+typedef struct FrameTimeStats {
+    float min;                      // Minimum time (seconds)
+    float avg;                      // Average time (seconds)
+    float p50;                      // Median time (seconds)
+    float p95;                      // 95th percentile time (seconds)
+    float p99;                      // 99th percentile time (seconds)
+    float max;                      // Maximum time (seconds)
+} FrameTimeStats;
+
+// Frame stats over frame stats window, SetFrameStatsWindow() to set the number of frames
+typedef struct FrameStats {
+    int frameCount;                 // Frames measured, up to frame stats window
+    FrameTimeStats update;          // Update times stats
+    FrameTimeStats draw;            // Draw times stats
+    FrameTimeStats swap;            // Buffers swap times stats
+    FrameTimeStats wait;            // Wait times stats
+    FrameTimeStats frame;           // Total frame times stats
+    unsigned int hitches;           // Hitch frames in window, longer than target frame time (or average) by FRAME_HITCH_FACTOR
+    unsigned int hitchesTotal;      // Hitch frames since window initialization
+} FrameStats;
+
+// Frame pacing stats, frame end time measured against frame pacer deadline
+typedef struct FramePacingStats {
+    int mode;                       // Frame pacing mode (FramePacingMode)
+    float slack;                    // Scheduler wake-up slack, busy-waited before deadline (seconds, self-calibrated)
+    float error;                    // Frame end average error from deadline (seconds)
+    float errorMax;                 // Frame end maximum error from deadline (seconds)
+    float jitter;                   // Frame end error standard deviation (seconds)
+    unsigned int missedDeadlines;   // Frames ended after their deadline, update and draw took too long
+} FramePacingStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -948,6 +1047,64 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Input event types, registered by the input events queue
+typedef enum {
+    INPUT_EVENT_KEY = 0,            // Keyboard key pressed/released
+    INPUT_EVENT_MOUSE_BUTTON,       // Mouse button pressed/released
+    INPUT_EVENT_GAMEPAD_BUTTON,     // Gamepad button pressed/released
+    INPUT_EVENT_TOUCH               // Touch point down/up
+} InputEventType;
+
+// Gamepad polling source, used by gamepad polling thread
+typedef enum {
+    GAMEPAD_POLLING_DEVICE = 0,     // Poll connected gamepad devices (platform support required)
+    GAMEPAD_POLLING_VIRTUAL         // Poll a virtual gamepad (as gamepad 0) with a generated pattern, for testing without devices
+} GamepadPollingSource;
+
+// Frame pacing mode, used by EndDrawing() to wait for target frame time
+typedef enum {
+    FRAME_PACING_PRECISE = 0,       // Absolute deadline sleep, woken up a self-calibrated slack earlier to busy wait until deadline (default)
+    FRAME_PACING_LOW_POWER,         // Absolute deadline sleep only, no busy wait, scheduler wake-up latency is not compensated
+    FRAME_PACING_LEGACY             // WaitTime() for remaining frame time, relative wait without a fixed cadence
+} FramePacingMode;
+
+// Audio device performance profile
+// NOTE: Used by backend to choose default period sizes
+typedef enum {
+    AUDIO_PROFILE_LOW_LATENCY = 0,  // Small periods, lower latency (default)
+    AUDIO_PROFILE_CONSERVATIVE      // Bigger periods, less prone to glitches
+} AudioPerformanceProfile;
+
+// Audio device share mode
+typedef enum {
+    AUDIO_SHARE_MODE_SHARED = 0,    // Device shared with other applications (default)
+    AUDIO_SHARE_MODE_EXCLUSIVE      // Device exclusive access, lower latency if supported by backend
+} AudioShareMode;
+
+// Sound instances voice stealing mode, used when no voice is available
+typedef enum {
+    AUDIO_VOICE_STEAL_OLDEST = 0,   // Steal the oldest playing voice (default)
+    AUDIO_VOICE_STEAL_QUIETEST      // Steal the quietest playing voice
+} AudioVoiceStealMode;
+
+// Audio buses (submixes), additional user buses up to MAX_AUDIO_BUSES can be used by index
+typedef enum {
+    AUDIO_BUS_MUSIC = 0,            // Music bus, music streams default bus
+    AUDIO_BUS_SFX,                  // Sound effects bus, sounds and audio streams default bus
+    AUDIO_BUS_UI,                   // User interface sounds bus
+    AUDIO_BUS_VOICE                 // Voice and dialogue bus
+} AudioBusType;
+
+// Audio bus built-in effects, parameters are set by index with SetAudioBusEffectParam()
+typedef enum {
+    AUDIO_EFFECT_LOWPASS = 0,       // Low-pass biquad filter: [0] cutoff (Hz), [1] resonance (Q)
+    AUDIO_EFFECT_HIGHPASS,          // High-pass biquad filter: [0] cutoff (Hz), [1] resonance (Q)
+    AUDIO_EFFECT_BANDPASS,          // Band-pass biquad filter: [0] center (Hz), [1] resonance (Q)
+    AUDIO_EFFECT_COMPRESSOR,        // Compressor: [0] threshold (dB), [1] ratio, [2] attack (ms), [3] release (ms)
+    AUDIO_EFFECT_LIMITER,           // Limiter: [0] ceiling (dB), [1] release (ms)
+    AUDIO_EFFECT_REVERB             // Reverb: [0] room size [0..1], [1] damping [0..1], [2] wet level [0..1]
+} AudioEffectType;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1080,6 +1237,13 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 RLAPI int GetFPS(void);                                           // Get current FPS
+RLAPI void SetFramePacingMode(int mode);                          // Set frame pacing mode (FramePacingMode), used to wait for target FPS
+RLAPI FramePacingStats GetFramePacingStats(void);                 // Get frame pacing stats: wake-up slack, frame end error, jitter and missed deadlines
+RLAPI void EnableSimulatedClock(double step);                     // Enable simulated clock, time advances by step (seconds, 0 for target) per frame without waiting
+RLAPI void DisableSimulatedClock(void);                           // Disable simulated clock, real clock is used
+RLAPI void SetFrameStatsWindow(int frames);                       // Set frame stats window, number of last frames used by GetFrameStats()
+RLAPI FrameStats GetFrameStats(void);                             // Get frame stats: update, draw, swap, wait and frame times percentiles and hitches
+RLAPI int GetFrameTimingHistory(FrameTiming *timings, int count); // Get last frames timings (oldest first), returns number of frames copied
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1161,9 +1325,10 @@ RLAPI unsigned int *ComputeSHA1(unsigned char *data, int dataSize);     // Compu
 
 
 // Automation events functionality
-RLAPI AutomationEventList LoadAutomationEventList(const char *fileName);                // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
+RLAPI AutomationEventList LoadAutomationEventList(const char *fileName);                // Load automation events list from file (text or binary), NULL for empty list
 RLAPI void UnloadAutomationEventList(AutomationEventList list);                         // Unload automation events list from file
-RLAPI bool ExportAutomationEventList(AutomationEventList list, const char *fileName);   // Export automation events list as text file
+RLAPI bool ExportAutomationEventList(AutomationEventList list, const char *fileName);   // Export automation events list as text file, or compact binary file (.raeb)
+RLAPI bool SetAutomationEventStream(const char *fileName);                              // Set binary file to stream recorded events to in chunks, NULL to close (list recorded to is emptied on every chunk, list count is 0 after StopAutomationEventRecording())
 RLAPI void SetAutomationEventList(AutomationEventList *list);                           // Set automation event list to record to
 RLAPI void SetAutomationEventBaseFrame(int frame);                                      // Set automation event internal base frame to start recording
 RLAPI void StartAutomationEventRecording(void);                                         // Start recording automation events (AutomationEventList must be set)
@@ -1197,6 +1362,8 @@ RLAPI int GetGamepadAxisCount(int gamepad);
 RLAPI float GetGamepadAxisMovement(int gamepad, int axis);                         // Get axis movement value for a gamepad axis
 RLAPI int SetGamepadMappings(const char *mappings);                                // Set internal gamepad mappings (SDL_GameControllerDB)
 RLAPI void SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration); // Set gamepad vibration for both motors (duration in seconds)
+RLAPI void EnableGamepadPolling(int rate, int source);                             // Enable gamepad polling thread at rate (Hz), independent of frame rate, timestamped states registered by PollInputEvents()
+RLAPI void DisableGamepadPolling(void);                                            // Disable gamepad polling thread
 
 // Input-related functions: mouse
 RLAPI bool IsMouseButtonPressed(int button);                  // Check if a mouse button has been pressed once
@@ -1221,6 +1388,12 @@ RLAPI Vector2 GetTouchPosition(int index);                    // Get touch posit
 RLAPI int GetTouchPointId(int index);                         // Get touch point identifier for given index
 RLAPI int GetTouchPointCount(void);                           // Get number of touch points
 
+// Input-related functions: events queue
+RLAPI void EnableInputEvents(void);                           // Enable input events queue, key/button/touch transitions queued with their timestamp
+RLAPI void DisableInputEvents(void);                          // Disable input events queue, queued events are discarded
+RLAPI int GetInputEvents(InputEvent *events, int max);        // Get queued input events (oldest first), returns number of events copied and removed from queue
+RLAPI void InjectInputEvent(InputEvent event);                // Inject a synthetic input event, registered as a platform input event
+
 //------------------------------------------------------------------------------------
 // Gestures and Touch Handling Functions (Module: rgestures)
 //------------------------------------------------------------------------------------
@@ -1477,6 +1650,7 @@ RLAPI bool ExportFontAsCode(Font font, const char *fileName);
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawFrameGraph(int posX, int posY, int width, int height);                       // Draw frame times graph: stacked update/draw/swap/wait bars for last frames
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
@@ -1631,10 +1805,19 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceEx(AudioDeviceConfig config);               // Initialize audio device and context with custom configuration
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI unsigned long long GetAudioClockFrames(void);                   // Get audio clock, total frames rendered by the mixer (sample-accurate scheduling reference)
+RLAPI unsigned int GetAudioClockSampleRate(void);                     // Get audio clock sample rate (device sample rate)
+RLAPI float GetAudioOutputLatency(void);                              // Get audio output latency, negotiated device buffering (in milliseconds)
+RLAPI int GetAudioOutputLatencyFrames(void);                          // Get audio output latency, negotiated device buffering (in frames)
+RLAPI AudioStats GetAudioStats(void);                                 // Get audio stats: sounds memory, mixed frames by path, compressed sounds decoding and mixer callbacks timing
+RLAPI void ResetAudioStats(void);                                     // Reset audio stats counters: mixed frames, decoding, callbacks timing and underruns
+RLAPI void GetAudioSpectrum(float *bands, int count, float smoothing); // Get mixed output spectrum levels in logarithmic bands [0..1], smoothed with previous bands values
+RLAPI void RenderAudioFrames(float *frames, int frameCount);          // Render audio frames in offline mode (interleaved float samples)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1642,6 +1825,7 @@ RLAPI Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileDat
 RLAPI bool IsWaveValid(Wave wave);                                    // Checks if wave data is valid (data loaded and parameters)
 RLAPI Sound LoadSound(const char *fileName);                          // Load sound from file
 RLAPI Sound LoadSoundFromWave(Wave wave);                             // Load sound from wave data
+RLAPI Sound LoadSoundCompressed(const char *fileName);                // Load sound from file, kept compressed in memory (QOA) and decoded on demand while playing
 RLAPI Sound LoadSoundAlias(Sound source);                             // Create a new sound that shares the same sample data as the source sound, does not own the sound data
 RLAPI bool IsSoundValid(Sound sound);                                 // Checks if a sound is valid (data loaded and buffers initialized)
 RLAPI void UpdateSound(Sound sound, const void *data, int sampleCount); // Update sound buffer with new data
@@ -1656,15 +1840,30 @@ RLAPI void PlaySound(Sound sound);                                    // Play a
 RLAPI void StopSound(Sound sound);                                    // Stop playing a sound
 RLAPI void PauseSound(Sound sound);                                   // Pause a sound
 RLAPI void ResumeSound(Sound sound);                                  // Resume a paused sound
+RLAPI void SeekSound(Sound sound, float position);                    // Seek a playing sound to a position (in seconds)
 RLAPI bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void PlaySoundScheduled(Sound sound, unsigned long long frame);  // Play a sound at a scheduled audio clock frame
+RLAPI void StopSoundScheduled(Sound sound, unsigned long long frame);  // Stop a sound at a scheduled audio clock frame
+RLAPI void SetSoundVolumeScheduled(Sound sound, float volume, unsigned long long frame, unsigned int rampFrames); // Set volume for a sound at a scheduled audio clock frame, ramping linearly
+RLAPI void SetSoundPanScheduled(Sound sound, float pan, unsigned long long frame, unsigned int rampFrames); // Set pan for a sound at a scheduled audio clock frame, ramping linearly
+RLAPI unsigned int PlaySoundInstance(Sound sound, int priority);      // Play a sound instance from voices pool, returns instance id (0 if no voice available)
+RLAPI void StopSoundInstance(unsigned int instance);                  // Stop a sound instance
+RLAPI bool IsSoundInstancePlaying(unsigned int instance);             // Check if a sound instance is currently playing
+RLAPI void SetSoundInstanceVolume(unsigned int instance, float volume); // Set volume for a sound instance (1.0 is max level)
+RLAPI void SetSoundInstancePitch(unsigned int instance, float pitch); // Set pitch for a sound instance (1.0 is base level)
+RLAPI void SetSoundInstancePan(unsigned int instance, float pan);     // Set pan for a sound instance (0.5 is center)
+RLAPI void SetSoundMaxInstances(Sound sound, int maxInstances);       // Set maximum number of instances of a sound playing at once (0 for no limit)
+RLAPI void SetAudioVoiceStealMode(int mode);                          // Set voices stealing mode, used when no voice is available (AudioVoiceStealMode)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
 RLAPI float *LoadWaveSamples(Wave wave);                              // Load samples data from wave as a 32bit float data array
 RLAPI void UnloadWaveSamples(float *samples);                         // Unload samples data loaded with LoadWaveSamples()
+RLAPI WaveRhythm LoadWaveRhythm(Wave wave);                           // Load rhythm analysis from wave: onsets, tempo and beat grid
+RLAPI void UnloadWaveRhythm(WaveRhythm rhythm);                       // Unload rhythm analysis data
 
 // Music management functions
 RLAPI Music LoadMusicStream(const char *fileName);                    // Load music stream from file
@@ -1678,11 +1877,19 @@ RLAPI void StopMusicStream(Music music);                              // Stop mu
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
 RLAPI void SeekMusicStream(Music music, float position);              // Seek music to a position (in seconds)
+RLAPI bool ExportMusicSeekIndex(Music music, const char *fileName);   // Export music seek index to file (MP3), returns true on success
+RLAPI bool ImportMusicSeekIndex(Music music, const char *fileName);   // Import music seek index from file (MP3), skips index building on first seek
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
 RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI unsigned int GetMusicPlayheadFrames(Music music);               // Get music playhead, frame being output by the device (interpolated, latency compensated)
+RLAPI float GetMusicBeatPosition(Music music, float bpm, float offset); // Get music playhead position in beats, from tempo (bpm) and first beat offset (in seconds)
+RLAPI void SetMusicStreamPrebuffer(Music music, int frames);          // Set music prebuffer frames, decoding it on a background thread (0 to decode on UpdateMusicStream())
+RLAPI unsigned int GetMusicStreamUnderruns(Music music);              // Get music underruns count, times decoded frames were not ready for the mixer
+RLAPI void SetMusicTempo(Music music, float tempo);                   // Set tempo for a music, keeping its pitch (1.0 is base tempo), time-stretched on decoder thread
+RLAPI void QueueMusicStream(Music music, Music next, float crossfade, bool gapless); // Queue next music after music, prebuffered, crossfade in seconds (gapless: splice at music end)
 
 // AudioStream management functions
 RLAPI AudioStream LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
@@ -1690,6 +1897,10 @@ RLAPI bool IsAudioStreamValid(AudioStream stream);                    // Checks
 RLAPI void UnloadAudioStream(AudioStream stream);                     // Unload audio stream and free memory
 RLAPI void UpdateAudioStream(AudioStream stream, const void *data, int frameCount); // Update audio stream buffers with data
 RLAPI bool IsAudioStreamProcessed(AudioStream stream);                // Check if any audio stream buffers requires refill
+RLAPI int PushAudioStreamFrames(AudioStream stream, const void *data, int frameCount); // Push frames to audio stream ring buffer, any number of frames, returns frames written
+RLAPI int GetAudioStreamWritableFrames(AudioStream stream);           // Get number of frames that can be pushed to audio stream without overrun
+RLAPI unsigned int GetAudioStreamUnderruns(AudioStream stream);       // Get audio stream underruns count, times pushed frames were not enough for the mixer
+RLAPI unsigned int GetAudioStreamOverruns(AudioStream stream);        // Get audio stream overruns count, times pushed frames did not fit in the ring buffer
 RLAPI void PlayAudioStream(AudioStream stream);                       // Play audio stream
 RLAPI void PauseAudioStream(AudioStream stream);                      // Pause audio stream
 RLAPI void ResumeAudioStream(AudioStream stream);                     // Resume audio stream
@@ -1706,6 +1917,19 @@ RLAPI void DetachAudioStreamProcessor(AudioStream stream, AudioCallback processo
 
 RLAPI void AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline, receives the samples as 'float'
 RLAPI void DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
+RLAPI float GetAudioProcessorTime(AudioCallback processor);   // Get audio processor average time per mixer callback, all processors attached with it (in seconds)
+
+// Audio buses management functions
+RLAPI void SetAudioBusVolume(int bus, float volume);                 // Set volume for an audio bus (1.0 is max level)
+RLAPI void SetAudioBusDucking(int bus, int triggerBus, float amount, float attack, float release); // Set bus ducking while trigger bus is playing (times in seconds, trigger -1 to disable)
+RLAPI int AddAudioBusEffect(int bus, int type);                      // Add built-in effect to bus effects chain (AudioEffectType), returns effect index (-1 on failure)
+RLAPI void SetAudioBusEffectParam(int bus, int effect, int param, float value); // Set bus effect parameter by index
+RLAPI void ClearAudioBusEffects(int bus);                            // Remove all effects from bus effects chain
+RLAPI void AttachAudioBusProcessor(int bus, AudioCallback processor); // Attach audio processor to bus, receives the bus samples as 'float'
+RLAPI void DetachAudioBusProcessor(int bus, AudioCallback processor); // Detach audio processor from bus
+RLAPI void SetSoundBus(Sound sound, int bus);                        // Set output bus for a sound and its instances (default: AUDIO_BUS_SFX)
+RLAPI void SetMusicBus(Music music, int bus);                        // Set output bus for a music stream (default: AUDIO_BUS_MUSIC)
+RLAPI void SetAudioStreamBus(AudioStream stream, int bus);           // Set output bus for an audio stream (default: AUDIO_BUS_SFX)
 
 #if defined(__cplusplus)
 }
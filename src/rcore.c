@@ -40,6 +40,7 @@
 *
 *       #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 *           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
+*           NOTE: Only used by WaitTime() and FRAME_PACING_LEGACY, frame pacer busy-waits a self-calibrated slack
 *
 *       #define SUPPORT_SCREEN_CAPTURE
 *           Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
@@ -90,9 +91,9 @@
     #define _XOPEN_SOURCE 500 // Required for: readlink if compiled with c99 without gnu ext.
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(PLATFORM_WEB)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without gnu ext.
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -108,7 +109,7 @@
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
-#include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
+#include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()], sqrt() [Used in GetFramePacingStats()]
 
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
@@ -165,15 +166,35 @@ __declspec(dllimport) unsigned int __stdcall timeBeginPeriod(unsigned int uPerio
 __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod);
 #elif defined(__linux__)
     #include <unistd.h>
+    #include <errno.h>              // Required for: EINTR [Used in SleepUntilTime()]
 #elif defined(__FreeBSD__)
     #include <sys/types.h>
     #include <sys/sysctl.h>
     #include <unistd.h>
+    #include <errno.h>              // Required for: EINTR [Used in SleepUntilTime()]
 #elif defined(__APPLE__)
     #include <sys/syslimits.h>
     #include <mach-o/dyld.h>
 #endif // OSs
 
+// NOTE: Android assets can not be memory-mapped, they are read through fopen() override
+#if defined(SUPPORT_AUTOMATION_EVENTS) && !defined(_WIN32) && !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID)
+    #define AUTOMATION_EVENTS_FILE_MMAP     // Automation events files memory-mapped on loading
+    #include <sys/mman.h>           // Required for: mmap(), munmap() [Used in LoadAutomationEventList()]
+    #include <fcntl.h>              // Required for: open() [Used in LoadAutomationEventList()]
+    #include <unistd.h>             // Required for: close() [Used in LoadAutomationEventList()]
+#endif
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    #if defined(_WIN32) || defined(PLATFORM_WEB) || defined(PLATFORM_ANDROID) || defined(PLATFORM_NX)
+        #undef SUPPORT_GAMEPAD_POLLING_THREAD   // Gamepad polling thread requires POSIX threads
+    #elif defined(PLATFORM_NULL) && !defined(__linux__) && !defined(__FreeBSD__) && !defined(__OpenBSD__)
+        #undef SUPPORT_GAMEPAD_POLLING_THREAD   // Gamepad polling thread requires a real clock, null platform only provides it on POSIX targets
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join() [Used in EnableGamepadPolling()]
+    #endif
+#endif
+
 #define _CRT_INTERNAL_NONSTDC_NAMES  1
 #include <sys/stat.h>               // Required for: stat(), S_ISREG [Used in GetFileModTime(), IsFilePath()]
 
@@ -244,13 +265,55 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 #ifndef MAX_CHAR_PRESSED_QUEUE
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
+#ifndef MAX_INPUT_EVENT_QUEUE
+    #define MAX_INPUT_EVENT_QUEUE        256        // Maximum number of timestamped input events queued, oldest are dropped
+#endif
+
+#ifndef MAX_GAMEPAD_POLLING_SNAPSHOTS
+    #define MAX_GAMEPAD_POLLING_SNAPSHOTS 256       // Maximum number of gamepad snapshots queued by polling thread, newer are dropped
+#endif
 
 #ifndef MAX_DECOMPRESSION_SIZE
     #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
 #endif
 
 #ifndef MAX_AUTOMATION_EVENTS
-    #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
+    #define MAX_AUTOMATION_EVENTS      16384        // Initial capacity of automation events list, grows as required
+#endif
+#ifndef AUTOMATION_EVENTS_CHUNK_SIZE
+    #define AUTOMATION_EVENTS_CHUNK_SIZE 1024       // Number of automation events per binary file chunk (streamed on recording)
+#endif
+
+// Automation events binary file format (.raeb), little-endian
+//   Header: file id "rAEB" (4 bytes), version (4 bytes)
+//   Chunks: events count (4 bytes), events data size (4 bytes), events data (varint-packed)
+//   Event:  frame delta, type and params count (type << 3 | count), params deltas (zig-zag)
+// NOTE: Frame delta is relative to previous event, params deltas relative to previous event of same type,
+// trailing zero params deltas are not stored, deltas are reset on every chunk so chunks decode independently
+#define AUTOMATION_EVENTS_FILE_VERSION     1        // Automation events binary file version
+#define AUTOMATION_EVENT_MAX_DATA_SIZE    30        // Automation event maximum packed size: 6 varints of 5 bytes max
+
+#ifndef MAX_FRAME_TIMING_HISTORY
+    #define MAX_FRAME_TIMING_HISTORY    1024        // Maximum number of frame timings kept in history (frame stats window)
+#endif
+#ifndef FRAME_STATS_WINDOW
+    #define FRAME_STATS_WINDOW           120        // Default frame stats window in frames
+#endif
+#ifndef FRAME_HITCH_FACTOR
+    #define FRAME_HITCH_FACTOR           1.5        // Hitch threshold, relative to target frame time (or average frame time if no target)
+#endif
+#ifndef SIMULATED_TIME_STEP
+    #define SIMULATED_TIME_STEP   (1.0/60.0)        // Simulated clock default step per frame, used if no step and no target FPS set
+#endif
+
+#ifndef FRAME_PACING_INITIAL_SLACK
+    #define FRAME_PACING_INITIAL_SLACK  0.002       // Frame pacer initial scheduler wake-up slack in seconds (self-calibrated)
+#endif
+#ifndef FRAME_PACING_MAX_SLACK
+    #define FRAME_PACING_MAX_SLACK      0.002       // Frame pacer maximum scheduler wake-up slack in seconds (busy-wait limit)
+#endif
+#ifndef FRAME_PACING_SLACK_STEP
+    #define FRAME_PACING_SLACK_STEP   0.00001       // Frame pacer slack calibration step in seconds, lowered per frame woken up in time
 #endif
 
 #ifndef DIRECTORY_FILTER_TAG
@@ -269,6 +332,20 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
+// Gamepad state snapshot, registered by gamepad polling thread
+typedef struct GamepadSnapshot {
+    unsigned long long timestamp;           // Snapshot time in nanoseconds (GetTime() base)
+    int gamepad;                            // Gamepad index
+    bool connected;                         // Gamepad connected
+    int axisCount;                          // Gamepad axis count
+    char buttons[MAX_GAMEPAD_BUTTONS];      // Gamepad buttons state
+    float axis[MAX_GAMEPAD_AXIS];           // Gamepad axis state
+} GamepadSnapshot;
+
+// Gamepad polling source, fills gamepad state snapshot, returns true if gamepad is connected
+// NOTE: Called from gamepad polling thread, snapshot timestamp can be set by source (0 for poll time)
+typedef bool (*GamepadPollingSourceFunc)(int gamepad, GamepadSnapshot *snapshot);
+
 // Core global state context data
 typedef struct CoreData {
     struct {
@@ -349,19 +426,62 @@ typedef struct CoreData {
             char currentButtonState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];     // Current gamepad buttons state
             char previousButtonState[MAX_GAMEPADS][MAX_GAMEPAD_BUTTONS];    // Previous gamepad buttons state
             float axisState[MAX_GAMEPADS][MAX_GAMEPAD_AXIS];                // Gamepad axis state
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+            struct {
+                bool active;                    // Gamepad polling thread active
+                int running;                    // Gamepad polling thread running flag (atomic)
+                int rate;                       // Gamepad polling rate in Hz
+                pthread_t thread;               // Gamepad polling thread handle
+                GamepadPollingSourceFunc source;        // Gamepad polling source in use
+                GamepadPollingSourceFunc deviceSource;  // Gamepad polling source for devices, set by platform if supported
+                GamepadSnapshot snapshots[MAX_GAMEPAD_POLLING_SNAPSHOTS];  // Gamepad snapshots queue (single producer/consumer ring buffer)
+                unsigned int head;              // Gamepad snapshots queue write position, written by polling thread (atomic)
+                unsigned int tail;              // Gamepad snapshots queue read position, written by main thread (atomic)
+                unsigned int dropped;           // Gamepad snapshots dropped, queue full (atomic)
+                bool connected[MAX_GAMEPADS];   // Gamepads connected, registered by polling thread
+            } Polling;
+#endif
 
         } Gamepad;
+        struct {
+            bool enabled;                   // Input events queue enabled
+            InputEvent queue[MAX_INPUT_EVENT_QUEUE];    // Input events queue (ring buffer)
+            int first;                      // Input events queue first event index
+            int count;                      // Input events queue count
+        } Events;
     } Input;
     struct {
         double current;                     // Current time measure
         double previous;                    // Previous time measure
         double update;                      // Time measure for frame update
         double draw;                        // Time measure for frame draw
+        double swap;                        // Time measure for buffers swap (included in draw)
         double frame;                       // Time measure for one frame
         double target;                      // Desired time for one frame, if 0 not applied
         unsigned long long int base;        // Base time measure for hi-res timer (PLATFORM_ANDROID, PLATFORM_DRM)
         unsigned int frameCounter;          // Frame counter
 
+        int pacing;                         // Frame pacing mode (FramePacingMode)
+        double deadline;                    // Frame pacer next frame end deadline, fixed cadence (0 if not started)
+        double slack;                       // Frame pacer scheduler wake-up slack, busy-waited before deadline
+        double error;                       // Frame pacer frame end errors from deadline, accumulated
+        double errorSquares;                // Frame pacer frame end squared errors from deadline, accumulated
+        double errorMax;                    // Frame pacer frame end maximum error from deadline
+        unsigned int errorCount;            // Frame pacer frames measured
+        unsigned int missed;                // Frame pacer frames ended after their deadline
+
+        FrameTiming history[MAX_FRAME_TIMING_HISTORY]; // Frame timings history (ring buffer)
+        bool historyHitch[MAX_FRAME_TIMING_HISTORY];   // Frame timings history hitch frames
+        int historyHead;                    // Frame timings history next entry index
+        int historyCount;                   // Frame timings history entries count
+        int historyWindow;                  // Frame stats window in frames
+        double average;                     // Frame time running average, hitch reference if no target
+        unsigned int hitches;               // Hitch frames counter
+
+        bool simulated;                     // Simulated clock enabled, time advances by a fixed step per frame
+        double step;                        // Simulated clock step per frame (0 for target frame time)
+        double simulatedTime;               // Simulated clock time, returned by GetTime()
+
     } Time;
 } CoreData;
 
@@ -471,6 +591,7 @@ struct AutomationEvent {
 
 static AutomationEventList *currentEventList = NULL;        // Current automation events list, set by user, keep internal pointer
 static bool automationEventRecording = false;               // Recording automation events flag
+static FILE *automationEventStream = NULL;                  // Automation events binary file, recorded events streamed in chunks
 //static short automationEventEnabled = 0b0000001111111111; // TODO: Automation events enabled for recording/playing
 #endif
 //-----------------------------------------------------------------------------------
@@ -489,6 +610,13 @@ extern int InitPlatform(void);          // Initialize platform (graphics, inputs
 extern void ClosePlatform(void);        // Close platform
 
 static void InitTimer(void);                                // Initialize timer, hi-resolution if available (required by InitPlatform())
+static void WaitFrameDeadline(void);                        // Wait for frame pacer deadline (required by EndDrawing())
+static double GetSimulatedTimeStep(void);                   // Get simulated clock step per frame (required by EndDrawing())
+static void RecordFrameTiming(void);                        // Record frame timing in history (required by EndDrawing())
+static FrameTimeStats GetFrameTimeStats(float *times, int count);  // Get frame times stats, times are sorted
+#if !defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+static void SleepUntilTime(double time);                    // Sleep until time (GetTime() base), absolute deadline if supported
+#endif
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
 
@@ -497,6 +625,21 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
+static bool GrowAutomationEventList(AutomationEventList *list);    // Grow automation events list capacity (x2)
+static void FlushAutomationEventStream(void);                   // Write recorded events to automation events stream, list emptied
+static bool WriteAutomationEventsChunk(FILE *file, const AutomationEvent *events, int count);  // Write automation events binary file chunk
+static int EncodeAutomationEvents(const AutomationEvent *events, int count, unsigned char *data); // Pack automation events, returns data size
+static int DecodeAutomationEvents(const unsigned char *data, int dataSize, AutomationEvent *events, int count);  // Unpack automation events, returns events count
+static unsigned char *LoadAutomationFileData(const char *fileName, int *dataSize);   // Load automation events file data (memory-mapped if supported)
+static void UnloadAutomationFileData(unsigned char *data, int dataSize);             // Unload automation events file data
+#endif
+
+static void RegisterInputEvent(int type, int device, int code, bool pressed, unsigned long long timestamp);  // Register input state from platform event, transitions are queued
+static void QueueInputEvent(int type, int device, int code, bool pressed, unsigned long long timestamp);     // Queue input event if input events queue is enabled
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+static void *GamepadPollingThread(void *arg);               // Gamepad polling thread, queues gamepad snapshots on state change
+static bool PollGamepadVirtual(int gamepad, GamepadSnapshot *snapshot);  // Gamepad polling source: virtual gamepad, generated pattern
+static void PollGamepadSnapshots(void);                     // Register gamepad snapshots queued by polling thread (required by PollInputEvents())
 #endif
 
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
@@ -550,6 +693,8 @@ const char *TextFormat(const char *text, ...);              // Formatting of tex
     #include "platforms/rcore_android.c"
 #elif defined(PLATFORM_NX)
     #include "platforms/rcore_nx.c"
+#elif defined(PLATFORM_NULL)
+    #include "platforms/rcore_null.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -619,6 +764,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_NULL)
+    TRACELOG(LOG_INFO, "Platform backend: NULL (headless)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -736,6 +883,14 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    DisableGamepadPolling();    // Stop gamepad polling thread, if active
+#endif
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    SetAutomationEventStream(NULL);     // Close automation events stream, if any
+#endif
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -936,17 +1091,33 @@ void EndDrawing(void)
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    double swapTime = GetTime();
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
     // Frame time control system
     CORE.Time.current = GetTime();
     CORE.Time.draw = CORE.Time.current - CORE.Time.previous;
+    CORE.Time.swap = CORE.Time.current - swapTime;
     CORE.Time.previous = CORE.Time.current;
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
     // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    if (CORE.Time.simulated)
+    {
+        // Simulated clock, no waiting, frame ends one step after its start
+        double step = GetSimulatedTimeStep();
+        if (CORE.Time.frame < step) CORE.Time.simulatedTime += step - CORE.Time.frame;
+
+        CORE.Time.current = GetTime();
+        CORE.Time.frame += CORE.Time.current - CORE.Time.previous;
+        CORE.Time.previous = CORE.Time.current;
+    }
+    else if (CORE.Time.pacing != FRAME_PACING_LEGACY)
+    {
+        if (CORE.Time.target > 0.0) WaitFrameDeadline();
+    }
+    else if (CORE.Time.frame < CORE.Time.target)
     {
         WaitTime(CORE.Time.target - CORE.Time.frame);
 
@@ -957,6 +1128,8 @@ void EndDrawing(void)
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
 
+    RecordFrameTiming();
+
     PollInputEvents();      // Poll user events (before next frame update)
 #endif
 
@@ -1650,6 +1823,8 @@ void SetTargetFPS(int fps)
     if (fps < 1) CORE.Time.target = 0.0;
     else CORE.Time.target = 1.0/(double)fps;
 
+    CORE.Time.deadline = 0.0;       // Frame pacer cadence restarted from next frame
+
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
@@ -1702,6 +1877,153 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Set frame pacing mode used by EndDrawing() to wait for target frame time
+// NOTE: Pacer cadence and error stats are restarted
+void SetFramePacingMode(int mode)
+{
+    if ((mode < FRAME_PACING_PRECISE) || (mode > FRAME_PACING_LEGACY))
+    {
+        TRACELOG(LOG_WARNING, "TIMER: Frame pacing mode not supported: %i", mode);
+        return;
+    }
+
+    CORE.Time.pacing = mode;
+    CORE.Time.deadline = 0.0;
+    CORE.Time.error = 0.0;
+    CORE.Time.errorSquares = 0.0;
+    CORE.Time.errorMax = 0.0;
+    CORE.Time.errorCount = 0;
+    CORE.Time.missed = 0;
+}
+
+// Enable simulated clock, time advances by step (in seconds) per frame, 0 for target frame time
+// NOTE: GetTime() and GetFrameTime() only advance with frames and WaitTime(), nothing waits for real time,
+// application runs as fast as possible and timings are reproducible, simulated clock is restarted from 0
+void EnableSimulatedClock(double step)
+{
+    if (step < 0.0)
+    {
+        TRACELOG(LOG_WARNING, "TIMER: Simulated clock step not valid: %f", step);
+        return;
+    }
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    if (CORE.Input.Gamepad.Polling.active)
+    {
+        TRACELOG(LOG_WARNING, "TIMER: Gamepad polling thread not available with simulated clock, polling disabled");
+        DisableGamepadPolling();
+    }
+#endif
+
+    CORE.Time.simulated = true;
+    CORE.Time.step = step;
+    CORE.Time.simulatedTime = 0.0;
+    CORE.Time.current = 0.0;
+    CORE.Time.previous = 0.0;
+    CORE.Time.frame = 0.0;          // First frame after restart has no delta, as the first frame after InitWindow()
+    CORE.Time.deadline = 0.0;
+
+    TRACELOG(LOG_INFO, "TIMER: Simulated clock enabled, step per frame: %02.03f milliseconds", (float)GetSimulatedTimeStep()*1000.0f);
+}
+
+// Disable simulated clock, real clock is used again
+void DisableSimulatedClock(void)
+{
+#if defined(PLATFORM_NULL) && !defined(__linux__) && !defined(__FreeBSD__) && !defined(__OpenBSD__)
+    TRACELOG(LOG_WARNING, "TIMER: Simulated clock can not be disabled on target platform");
+#else
+    if (!CORE.Time.simulated) return;
+
+    CORE.Time.simulated = false;
+    CORE.Time.current = GetTime();
+    CORE.Time.previous = CORE.Time.current;
+    CORE.Time.deadline = 0.0;       // Frame pacer cadence restarted from next frame
+
+    TRACELOG(LOG_INFO, "TIMER: Simulated clock disabled");
+#endif
+}
+
+// Set frame stats window, number of last frames used by GetFrameStats()
+void SetFrameStatsWindow(int frames)
+{
+    if (frames < 1) frames = 1;
+    else if (frames > MAX_FRAME_TIMING_HISTORY) frames = MAX_FRAME_TIMING_HISTORY;
+
+    CORE.Time.historyWindow = frames;
+}
+
+// Get frame stats over frame stats window: update, draw, swap, wait and total frame times and hitches
+// NOTE: Times are measured by EndDrawing(), no frame is recorded with SUPPORT_CUSTOM_FRAME_CONTROL
+FrameStats GetFrameStats(void)
+{
+    FrameStats stats = { 0 };
+
+    int count = CORE.Time.historyCount;
+    if (count > CORE.Time.historyWindow) count = CORE.Time.historyWindow;
+
+    if (count > 0)
+    {
+        float *times = (float *)RL_MALLOC(count*sizeof(float));
+        int first = (CORE.Time.historyHead - count + MAX_FRAME_TIMING_HISTORY)%MAX_FRAME_TIMING_HISTORY;
+
+        for (int i = 0; i < count; i++) times[i] = CORE.Time.history[(first + i)%MAX_FRAME_TIMING_HISTORY].update;
+        stats.update = GetFrameTimeStats(times, count);
+        for (int i = 0; i < count; i++) times[i] = CORE.Time.history[(first + i)%MAX_FRAME_TIMING_HISTORY].draw;
+        stats.draw = GetFrameTimeStats(times, count);
+        for (int i = 0; i < count; i++) times[i] = CORE.Time.history[(first + i)%MAX_FRAME_TIMING_HISTORY].swap;
+        stats.swap = GetFrameTimeStats(times, count);
+        for (int i = 0; i < count; i++) times[i] = CORE.Time.history[(first + i)%MAX_FRAME_TIMING_HISTORY].wait;
+        stats.wait = GetFrameTimeStats(times, count);
+        for (int i = 0; i < count; i++) times[i] = CORE.Time.history[(first + i)%MAX_FRAME_TIMING_HISTORY].frame;
+        stats.frame = GetFrameTimeStats(times, count);
+
+        for (int i = 0; i < count; i++) if (CORE.Time.historyHitch[(first + i)%MAX_FRAME_TIMING_HISTORY]) stats.hitches++;
+
+        RL_FREE(times);
+    }
+
+    stats.frameCount = count;
+    stats.hitchesTotal = CORE.Time.hitches;
+
+    return stats;
+}
+
+// Get frame timings history, last frames up to count (oldest first), returns number of frames copied
+int GetFrameTimingHistory(FrameTiming *timings, int count)
+{
+    if ((timings == NULL) || (count <= 0)) return 0;
+
+    if (count > CORE.Time.historyCount) count = CORE.Time.historyCount;
+    int first = (CORE.Time.historyHead - count + MAX_FRAME_TIMING_HISTORY)%MAX_FRAME_TIMING_HISTORY;
+
+    for (int i = 0; i < count; i++) timings[i] = CORE.Time.history[(first + i)%MAX_FRAME_TIMING_HISTORY];
+
+    return count;
+}
+
+// Get frame pacing stats: mode, wake-up slack, frame end error, jitter (error deviation) and missed deadlines
+FramePacingStats GetFramePacingStats(void)
+{
+    FramePacingStats stats = { 0 };
+
+    stats.mode = CORE.Time.pacing;
+    stats.slack = (float)CORE.Time.slack;
+    if (CORE.Time.errorCount > 0)
+    {
+        // Jitter is frame end error standard deviation
+        double mean = CORE.Time.error/(double)CORE.Time.errorCount;
+        double variance = CORE.Time.errorSquares/(double)CORE.Time.errorCount - mean*mean;
+
+        stats.error = (float)mean;
+        stats.jitter = (variance > 0.0)? (float)sqrt(variance) : 0.0f;
+    }
+
+    stats.errorMax = (float)CORE.Time.errorMax;
+    stats.missedDeadlines = CORE.Time.missed;
+
+    return stats;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -1719,6 +2041,13 @@ void WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
+    if (CORE.Time.simulated)
+    {
+        // Simulated clock, no waiting, time just advances
+        CORE.Time.simulatedTime += seconds;
+        return;
+    }
+
 #if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
@@ -2873,78 +3202,127 @@ unsigned int *ComputeSHA1(unsigned char *data, int dataSize)
 // Module Functions Definition: Automation Events Recording and Playing
 //----------------------------------------------------------------------------------
 
-// Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
+// Load automation events list from file (text or binary), NULL for empty list
+// NOTE: List capacity grows as required while recording, binary files are memory-mapped to be decoded
 AutomationEventList LoadAutomationEventList(const char *fileName)
 {
     AutomationEventList list = { 0 };
 
-    // Allocate and empty automation event list, ready to record new events
-    list.events = (AutomationEvent *)RL_CALLOC(MAX_AUTOMATION_EVENTS, sizeof(AutomationEvent));
-    list.capacity = MAX_AUTOMATION_EVENTS;
-
 #if defined(SUPPORT_AUTOMATION_EVENTS)
-    if (fileName == NULL) TRACELOG(LOG_INFO, "AUTOMATION: New empty events list loaded successfully");
+    if (fileName == NULL)
+    {
+        // Allocate and empty automation event list, ready to record new events
+        list.events = (AutomationEvent *)RL_CALLOC(MAX_AUTOMATION_EVENTS, sizeof(AutomationEvent));
+        list.capacity = MAX_AUTOMATION_EVENTS;
+
+        TRACELOG(LOG_INFO, "AUTOMATION: New empty events list loaded successfully");
+    }
     else
     {
-        // Load automation events file (binary)
-        /*
-        //int dataSize = 0;
-        //unsigned char *data = LoadFileData(fileName, &dataSize);
+        int dataSize = 0;
+        unsigned char *data = LoadAutomationFileData(fileName, &dataSize);
 
-        FILE *raeFile = fopen(fileName, "rb");
-        unsigned char fileId[4] = { 0 };
+        if ((data != NULL) && (dataSize >= 8) && (memcmp(data, "rAEB", 4) == 0))
+        {
+            // Load events file (binary)
+            // NOTE: Chunks headers are checked first to allocate the exact events count
+            unsigned int count = 0;
+            int offset = 8;
 
-        fread(fileId, 1, 4, raeFile);
+            unsigned int version = data[4] | (data[5] << 8) | (data[6] << 16) | ((unsigned int)data[7] << 24);
+            if (version != AUTOMATION_EVENTS_FILE_VERSION)
+            {
+                TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file version not supported: %i", fileName, version);
+                offset = dataSize;
+            }
 
-        if ((fileId[0] == 'r') && (fileId[1] == 'A') && (fileId[2] == 'E') && (fileId[1] == ' '))
-        {
-            fread(&eventCount, sizeof(int), 1, raeFile);
-            TRACELOG(LOG_WARNING, "Events loaded: %i\n", eventCount);
-            fread(events, sizeof(AutomationEvent), eventCount, raeFile);
-        }
+            while ((dataSize - offset) >= 8)
+            {
+                unsigned int chunkCount = data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | ((unsigned int)data[offset + 3] << 24);
+                unsigned int chunkSize = data[offset + 4] | (data[offset + 5] << 8) | (data[offset + 6] << 16) | ((unsigned int)data[offset + 7] << 24);
 
-        fclose(raeFile);
-        */
+                if ((chunkSize > (unsigned int)(dataSize - offset - 8)) || (chunkCount > chunkSize)) break;
 
-        // Load events file (text)
-        //unsigned char *buffer = LoadFileText(fileName);
-        FILE *raeFile = fopen(fileName, "rt");
+                count += chunkCount;
+                offset += 8 + chunkSize;
+            }
 
-        if (raeFile != NULL)
-        {
-            unsigned int counter = 0;
-            char buffer[256] = { 0 };
-            char eventDesc[64] = { 0 };
+            if (offset != dataSize) TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file data not valid, truncated", fileName);
 
-            fgets(buffer, 256, raeFile);
+            list.events = (AutomationEvent *)RL_CALLOC((count > 0)? count : 1, sizeof(AutomationEvent));
+            list.capacity = (count > 0)? count : 1;
 
-            while (!feof(raeFile))
+            offset = 8;
+            while (list.count < count)
             {
-                switch (buffer[0])
-                {
-                    case 'c': sscanf(buffer, "c %i", &list.count); break;
-                    case 'e':
-                    {
-                        sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &list.events[counter].frame, &list.events[counter].type,
-                               &list.events[counter].params[0], &list.events[counter].params[1], &list.events[counter].params[2], &list.events[counter].params[3], eventDesc);
+                unsigned int chunkCount = data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | ((unsigned int)data[offset + 3] << 24);
+                unsigned int chunkSize = data[offset + 4] | (data[offset + 5] << 8) | (data[offset + 6] << 16) | ((unsigned int)data[offset + 7] << 24);
+
+                int decoded = DecodeAutomationEvents(data + offset + 8, chunkSize, list.events + list.count, chunkCount);
+                list.count += decoded;
 
-                        counter++;
-                    } break;
-                    default: break;
+                if (decoded != (int)chunkCount)
+                {
+                    TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events data not valid, events decoded: %i", fileName, list.count);
+                    break;
                 }
 
-                fgets(buffer, 256, raeFile);
+                offset += 8 + chunkSize;
             }
 
-            if (counter != list.count)
+            UnloadAutomationFileData(data, dataSize);
+
+            TRACELOG(LOG_INFO, "AUTOMATION: Events file loaded successfully (binary)");
+        }
+        else
+        {
+            UnloadAutomationFileData(data, dataSize);
+
+            list.events = (AutomationEvent *)RL_CALLOC(MAX_AUTOMATION_EVENTS, sizeof(AutomationEvent));
+            list.capacity = MAX_AUTOMATION_EVENTS;
+
+            // Load events file (text)
+            //unsigned char *buffer = LoadFileText(fileName);
+            FILE *raeFile = fopen(fileName, "rt");
+
+            if (raeFile != NULL)
             {
-                TRACELOG(LOG_WARNING, "AUTOMATION: Events read from file [%i] do not mach event count specified [%i]", counter, list.count);
-                list.count = counter;
-            }
+                unsigned int counter = 0;
+                char buffer[256] = { 0 };
+                char eventDesc[64] = { 0 };
+
+                fgets(buffer, 256, raeFile);
+
+                while (!feof(raeFile))
+                {
+                    switch (buffer[0])
+                    {
+                        case 'c': sscanf(buffer, "c %i", &list.count); break;
+                        case 'e':
+                        {
+                            if ((counter == list.capacity) && !GrowAutomationEventList(&list)) break;
 
-            fclose(raeFile);
+                            sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &list.events[counter].frame, &list.events[counter].type,
+                                   &list.events[counter].params[0], &list.events[counter].params[1], &list.events[counter].params[2], &list.events[counter].params[3], eventDesc);
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Events file loaded successfully");
+                            counter++;
+                        } break;
+                        default: break;
+                    }
+
+                    fgets(buffer, 256, raeFile);
+                }
+
+                if (counter != list.count)
+                {
+                    TRACELOG(LOG_WARNING, "AUTOMATION: Events read from file [%i] do not mach event count specified [%i]", counter, list.count);
+                    list.count = counter;
+                }
+
+                fclose(raeFile);
+
+                TRACELOG(LOG_INFO, "AUTOMATION: Events file loaded successfully");
+            }
         }
 
         TRACELOG(LOG_INFO, "AUTOMATION: Events loaded from file: %i", list.count);
@@ -2961,22 +3339,36 @@ void UnloadAutomationEventList(AutomationEventList list)
 #endif
 }
 
-// Export automation events list as text file
+// Export automation events list as text file, or binary file (.raeb)
 bool ExportAutomationEventList(AutomationEventList list, const char *fileName)
 {
     bool success = false;
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
-    // Export events as binary file
-    // TODO: Save to memory buffer and SaveFileData()
-    /*
-    unsigned char fileId[4] = "rAE ";
-    FILE *raeFile = fopen(fileName, "wb");
-    fwrite(fileId, sizeof(unsigned char), 4, raeFile);
-    fwrite(&eventCount, sizeof(int), 1, raeFile);
-    fwrite(events, sizeof(AutomationEvent), eventCount, raeFile);
-    fclose(raeFile);
-    */
+    if (IsFileExtension(fileName, ".raeb"))
+    {
+        // Export events as binary file, in chunks
+        FILE *raeFile = fopen(fileName, "wb");
+
+        if (raeFile != NULL)
+        {
+            unsigned char header[8] = { 'r', 'A', 'E', 'B', AUTOMATION_EVENTS_FILE_VERSION, 0, 0, 0 };
+            success = (fwrite(header, 1, 8, raeFile) == 8);
+
+            for (unsigned int i = 0; success && (i < list.count); i += AUTOMATION_EVENTS_CHUNK_SIZE)
+            {
+                int count = ((list.count - i) < AUTOMATION_EVENTS_CHUNK_SIZE)? (int)(list.count - i) : AUTOMATION_EVENTS_CHUNK_SIZE;
+                success = WriteAutomationEventsChunk(raeFile, list.events + i, count);
+            }
+
+            if (fclose(raeFile) != 0) success = false;
+        }
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Automation events file saved successfully (binary)", fileName);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to save automation events file", fileName);
+
+        return success;
+    }
 
     // Export events as text
     // TODO: Save to memory buffer and SaveFileText()
@@ -3035,13 +3427,55 @@ void StartAutomationEventRecording(void)
 }
 
 // Stop recording automation events
+// NOTE: If streaming, recorded events are written to automation events stream, list recorded to is emptied
 void StopAutomationEventRecording(void)
 {
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     automationEventRecording = false;
+    FlushAutomationEventStream();
 #endif
 }
 
+// Set automation events binary file to stream recorded events to, NULL to close stream
+// NOTE: Recorded events are written in chunks while recording, list set to record to is emptied on every chunk,
+// so memory usage does not grow with recording length, file can be loaded with LoadAutomationEventList()
+bool SetAutomationEventStream(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (automationEventStream != NULL)
+    {
+        FlushAutomationEventStream();
+        fclose(automationEventStream);
+        automationEventStream = NULL;
+
+        TRACELOG(LOG_INFO, "AUTOMATION: Events stream closed");
+    }
+
+    if (fileName == NULL) return true;
+
+    automationEventStream = fopen(fileName, "wb");
+
+    if (automationEventStream != NULL)
+    {
+        unsigned char header[8] = { 'r', 'A', 'E', 'B', AUTOMATION_EVENTS_FILE_VERSION, 0, 0, 0 };
+        success = (fwrite(header, 1, 8, automationEventStream) == 8);
+    }
+
+    if (success) TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events stream opened successfully", fileName);
+    else
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events stream", fileName);
+
+        if (automationEventStream != NULL) fclose(automationEventStream);
+        automationEventStream = NULL;
+    }
+#endif
+
+    return success;
+}
+
 // Play a recorded automation event
 void PlayAutomationEvent(AutomationEvent event)
 {
@@ -3512,6 +3946,166 @@ int GetTouchPointCount(void)
     return CORE.Input.Touch.pointCount;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Events queue
+//----------------------------------------------------------------------------------
+
+// Enable input events queue, key/button/touch transitions are queued with their timestamp
+// NOTE: Queue is reset on InitWindow(), it should be enabled after it
+void EnableInputEvents(void)
+{
+    CORE.Input.Events.enabled = true;
+}
+
+// Disable input events queue, queued events are discarded
+void DisableInputEvents(void)
+{
+    CORE.Input.Events.enabled = false;
+    CORE.Input.Events.first = 0;
+    CORE.Input.Events.count = 0;
+}
+
+// Get queued input events (oldest first), returns number of events copied
+// NOTE: Copied events are removed from the queue, events are registered by PollInputEvents()
+int GetInputEvents(InputEvent *events, int max)
+{
+    int count = 0;
+
+    if (events != NULL)
+    {
+        while ((count < max) && (CORE.Input.Events.count > 0))
+        {
+            events[count] = CORE.Input.Events.queue[CORE.Input.Events.first];
+            CORE.Input.Events.first = (CORE.Input.Events.first + 1)%MAX_INPUT_EVENT_QUEUE;
+            CORE.Input.Events.count--;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// Inject a synthetic input event, registered as if it was received from the platform
+// NOTE: Mouse button and touch events also move mouse/touch point to event position
+void InjectInputEvent(InputEvent event)
+{
+    switch (event.type)
+    {
+        case INPUT_EVENT_KEY:
+        {
+            if (event.pressed && (event.code > 0) && (event.code < MAX_KEYBOARD_KEYS) &&
+                (CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE))
+            {
+                CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = event.code;
+                CORE.Input.Keyboard.keyPressedQueueCount++;
+            }
+        } break;
+        case INPUT_EVENT_MOUSE_BUTTON:
+        {
+            CORE.Input.Mouse.currentPosition = event.position;
+            CORE.Input.Touch.position[0] = event.position;
+        } break;
+        case INPUT_EVENT_GAMEPAD_BUTTON:
+        {
+            if ((event.device >= 0) && (event.device < MAX_GAMEPADS)) CORE.Input.Gamepad.ready[event.device] = true;
+        } break;
+        case INPUT_EVENT_TOUCH:
+        {
+            if ((event.device >= 0) && (event.device < MAX_TOUCH_POINTS))
+            {
+                CORE.Input.Touch.position[event.device] = event.position;
+                if (event.device == 0) CORE.Input.Mouse.currentPosition = event.position;
+            }
+        } break;
+        default: break;
+    }
+
+    RegisterInputEvent(event.type, event.device, event.code, event.pressed, event.timestamp);
+
+    if (event.type == INPUT_EVENT_TOUCH)
+    {
+        CORE.Input.Touch.pointCount = 0;
+        for (int i = 0; i < MAX_TOUCH_POINTS; i++) if (CORE.Input.Touch.currentTouchState[i]) CORE.Input.Touch.pointCount++;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Gamepad polling
+//----------------------------------------------------------------------------------
+
+// Enable gamepad polling thread, gamepads are polled at rate (Hz) independently of frame rate
+// NOTE: Polled states are registered with their timestamp on PollInputEvents(), see GetInputEvents()
+void EnableGamepadPolling(int rate, int source)
+{
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    if (CORE.Input.Gamepad.Polling.active) DisableGamepadPolling();
+
+    if (CORE.Time.simulated)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: Gamepad polling thread not available with simulated clock");
+        return;
+    }
+
+    if (rate <= 0)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: Gamepad polling rate not valid: %i", rate);
+        return;
+    }
+
+    if (source == GAMEPAD_POLLING_VIRTUAL) CORE.Input.Gamepad.Polling.source = PollGamepadVirtual;
+    else CORE.Input.Gamepad.Polling.source = CORE.Input.Gamepad.Polling.deviceSource;
+
+    if (CORE.Input.Gamepad.Polling.source == NULL)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: Gamepad polling of devices not supported by current platform");
+        return;
+    }
+
+    CORE.Input.Gamepad.Polling.rate = rate;
+    CORE.Input.Gamepad.Polling.head = 0;
+    CORE.Input.Gamepad.Polling.tail = 0;
+    CORE.Input.Gamepad.Polling.dropped = 0;
+    for (int i = 0; i < MAX_GAMEPADS; i++) CORE.Input.Gamepad.Polling.connected[i] = false;
+
+    if (source == GAMEPAD_POLLING_VIRTUAL) strcpy(CORE.Input.Gamepad.name[0], "Virtual Gamepad");
+
+    __atomic_store_n(&CORE.Input.Gamepad.Polling.running, 1, __ATOMIC_RELEASE);
+
+    if (pthread_create(&CORE.Input.Gamepad.Polling.thread, NULL, GamepadPollingThread, NULL) != 0)
+    {
+        TRACELOG(LOG_WARNING, "INPUT: Failed to create gamepad polling thread");
+        return;
+    }
+
+    CORE.Input.Gamepad.Polling.active = true;
+
+    TRACELOG(LOG_INFO, "INPUT: Gamepad polling thread started at %i Hz (%s)", rate, (source == GAMEPAD_POLLING_VIRTUAL)? "virtual" : "devices");
+#else
+    TRACELOG(LOG_WARNING, "INPUT: Gamepad polling thread not supported");
+#endif
+}
+
+// Disable gamepad polling thread, gamepads are polled again by PollInputEvents()
+void DisableGamepadPolling(void)
+{
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+    if (!CORE.Input.Gamepad.Polling.active) return;
+
+    __atomic_store_n(&CORE.Input.Gamepad.Polling.running, 0, __ATOMIC_RELEASE);
+    pthread_join(CORE.Input.Gamepad.Polling.thread, NULL);
+
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.Polling.connected[i]) CORE.Input.Gamepad.ready[i] = false;
+        CORE.Input.Gamepad.Polling.connected[i] = false;
+    }
+
+    CORE.Input.Gamepad.Polling.active = false;
+
+    TRACELOG(LOG_INFO, "INPUT: Gamepad polling thread stopped (%u snapshots dropped)", CORE.Input.Gamepad.Polling.dropped);
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -3542,8 +4136,339 @@ void InitTimer(void)
 #endif
 
     CORE.Time.previous = GetTime();     // Get time as double
+
+    CORE.Time.deadline = 0.0;
+    CORE.Time.slack = FRAME_PACING_INITIAL_SLACK;
+
+    CORE.Time.historyHead = 0;
+    CORE.Time.historyCount = 0;
+    CORE.Time.average = 0.0;
+    CORE.Time.hitches = 0;
+    if (CORE.Time.historyWindow == 0) CORE.Time.historyWindow = FRAME_STATS_WINDOW;
 }
 
+// Register input state from a platform event, state transitions are queued with their timestamp
+// NOTE: Timestamp in nanoseconds (GetTime() base), taken as close as possible to the OS event, 0 for current time
+static void RegisterInputEvent(int type, int device, int code, bool pressed, unsigned long long timestamp)
+{
+    char *state = NULL;
+
+    switch (type)
+    {
+        case INPUT_EVENT_KEY: if ((code > 0) && (code < MAX_KEYBOARD_KEYS)) state = &CORE.Input.Keyboard.currentKeyState[code]; break;
+        case INPUT_EVENT_MOUSE_BUTTON: if ((code >= 0) && (code < MAX_MOUSE_BUTTONS)) state = &CORE.Input.Mouse.currentButtonState[code]; break;
+        case INPUT_EVENT_GAMEPAD_BUTTON:
+        {
+            if ((device >= 0) && (device < MAX_GAMEPADS) && (code >= 0) && (code < MAX_GAMEPAD_BUTTONS)) state = &CORE.Input.Gamepad.currentButtonState[device][code];
+        } break;
+        case INPUT_EVENT_TOUCH: if ((device >= 0) && (device < MAX_TOUCH_POINTS)) state = &CORE.Input.Touch.currentTouchState[device]; break;
+        default: break;
+    }
+
+    if (state == NULL) return;
+
+    if (*state != (char)pressed)
+    {
+        *state = (char)pressed;
+        QueueInputEvent(type, device, code, pressed, timestamp);
+    }
+}
+
+// Queue input event if input events queue is enabled, oldest event is dropped if queue is full
+static void QueueInputEvent(int type, int device, int code, bool pressed, unsigned long long timestamp)
+{
+    if (!CORE.Input.Events.enabled) return;
+
+    if (CORE.Input.Events.count == MAX_INPUT_EVENT_QUEUE)
+    {
+        CORE.Input.Events.first = (CORE.Input.Events.first + 1)%MAX_INPUT_EVENT_QUEUE;
+        CORE.Input.Events.count--;
+    }
+
+    InputEvent event = { 0 };
+    // NOTE: With simulated clock, platform timestamps (real clock) are replaced by simulated time
+    event.timestamp = ((timestamp != 0) && !CORE.Time.simulated)? timestamp : (unsigned long long)(GetTime()*1000000000.0);
+    event.type = type;
+    event.device = device;
+    event.code = code;
+    event.pressed = pressed;
+    event.position = (type == INPUT_EVENT_TOUCH)? CORE.Input.Touch.position[device] : CORE.Input.Mouse.currentPosition;
+
+    CORE.Input.Events.queue[(CORE.Input.Events.first + CORE.Input.Events.count)%MAX_INPUT_EVENT_QUEUE] = event;
+    CORE.Input.Events.count++;
+}
+
+#if defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+// Gamepad polling thread, queues gamepad snapshots on state change
+// NOTE: Only the polling thread writes head, only the main thread writes tail
+static void *GamepadPollingThread(void *arg)
+{
+    GamepadSnapshot last[MAX_GAMEPADS] = { 0 };
+    double period = 1.0/CORE.Input.Gamepad.Polling.rate;
+    double next = GetTime();
+
+    while (__atomic_load_n(&CORE.Input.Gamepad.Polling.running, __ATOMIC_ACQUIRE))
+    {
+        for (int i = 0; i < MAX_GAMEPADS; i++)
+        {
+            GamepadSnapshot snapshot = { 0 };
+            snapshot.gamepad = i;
+            snapshot.connected = CORE.Input.Gamepad.Polling.source(i, &snapshot);
+
+            // Queue snapshot only if gamepad state changed
+            if ((snapshot.connected == last[i].connected) && (snapshot.axisCount == last[i].axisCount) &&
+                (memcmp(snapshot.buttons, last[i].buttons, sizeof(snapshot.buttons)) == 0) &&
+                (memcmp(snapshot.axis, last[i].axis, sizeof(snapshot.axis)) == 0)) continue;
+
+            if (snapshot.timestamp == 0) snapshot.timestamp = (unsigned long long)(GetTime()*1000000000.0);
+
+            unsigned int head = __atomic_load_n(&CORE.Input.Gamepad.Polling.head, __ATOMIC_RELAXED);
+            unsigned int tail = __atomic_load_n(&CORE.Input.Gamepad.Polling.tail, __ATOMIC_ACQUIRE);
+
+            if ((head - tail) < MAX_GAMEPAD_POLLING_SNAPSHOTS)
+            {
+                CORE.Input.Gamepad.Polling.snapshots[head%MAX_GAMEPAD_POLLING_SNAPSHOTS] = snapshot;
+                __atomic_store_n(&CORE.Input.Gamepad.Polling.head, head + 1, __ATOMIC_RELEASE);
+                last[i] = snapshot;
+            }
+            else __atomic_fetch_add(&CORE.Input.Gamepad.Polling.dropped, 1, __ATOMIC_RELAXED);    // Retried on next poll
+        }
+
+        // Keep a fixed polling cadence, resync if more than one period late
+        next += period;
+        if ((GetTime() - next) > period) next = GetTime();
+        SleepUntilTime(next);
+    }
+
+    return NULL;
+}
+
+// Gamepad polling source: virtual gamepad (as gamepad 0), generated pattern for testing without devices
+// NOTE: Right face down button pressed on every beat at 120 bpm (50 ms), right face right on off-beats,
+// left stick draws a circle every 2 seconds, triggers released
+static bool PollGamepadVirtual(int gamepad, GamepadSnapshot *snapshot)
+{
+    if (gamepad != 0) return false;
+
+    double time = GetTime();
+    double beat = fmod(time, 0.5);
+
+    snapshot->buttons[GAMEPAD_BUTTON_RIGHT_FACE_DOWN] = (beat < 0.05);
+    snapshot->buttons[GAMEPAD_BUTTON_RIGHT_FACE_RIGHT] = ((beat >= 0.25) && (beat < 0.3));
+
+    snapshot->axisCount = GAMEPAD_AXIS_RIGHT_TRIGGER + 1;
+    snapshot->axis[GAMEPAD_AXIS_LEFT_X] = (float)sin(time*PI);
+    snapshot->axis[GAMEPAD_AXIS_LEFT_Y] = (float)cos(time*PI);
+    snapshot->axis[GAMEPAD_AXIS_LEFT_TRIGGER] = -1.0f;
+    snapshot->axis[GAMEPAD_AXIS_RIGHT_TRIGGER] = -1.0f;
+
+    return true;
+}
+
+// Register gamepad snapshots queued by polling thread, in order, button transitions keep snapshot timestamp
+// NOTE: Called by PollInputEvents() after platform gamepads update, polled gamepads state prevails
+static void PollGamepadSnapshots(void)
+{
+    if (!CORE.Input.Gamepad.Polling.active) return;
+
+    // Register previous gamepad states
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.Polling.connected[i])
+        {
+            for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+        }
+    }
+
+    unsigned int tail = CORE.Input.Gamepad.Polling.tail;
+    unsigned int head = __atomic_load_n(&CORE.Input.Gamepad.Polling.head, __ATOMIC_ACQUIRE);
+
+    for (; tail != head; tail++)
+    {
+        const GamepadSnapshot *snapshot = &CORE.Input.Gamepad.Polling.snapshots[tail%MAX_GAMEPAD_POLLING_SNAPSHOTS];
+        int gamepad = snapshot->gamepad;
+
+        CORE.Input.Gamepad.Polling.connected[gamepad] = snapshot->connected;
+        if (!snapshot->connected) continue;
+
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++)
+        {
+            if (snapshot->buttons[k] && !CORE.Input.Gamepad.currentButtonState[gamepad][k]) CORE.Input.Gamepad.lastButtonPressed = k;
+            RegisterInputEvent(INPUT_EVENT_GAMEPAD_BUTTON, gamepad, k, (snapshot->buttons[k] != 0), snapshot->timestamp);
+        }
+
+        for (int k = 0; k < MAX_GAMEPAD_AXIS; k++) CORE.Input.Gamepad.axisState[gamepad][k] = snapshot->axis[k];
+        CORE.Input.Gamepad.axisCount[gamepad] = snapshot->axisCount;
+    }
+
+    __atomic_store_n(&CORE.Input.Gamepad.Polling.tail, tail, __ATOMIC_RELEASE);
+
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.Polling.connected[i]) CORE.Input.Gamepad.ready[i] = true;
+    }
+}
+#endif
+
+// Record last frame timing in history, frame is checked for hitch
+// NOTE: Draw time is measured before swap, update time is measured from previous frame end
+static void RecordFrameTiming(void)
+{
+    FrameTiming timing = { 0 };
+    timing.update = (float)CORE.Time.update;
+    timing.draw = (float)(CORE.Time.draw - CORE.Time.swap);
+    timing.swap = (float)CORE.Time.swap;
+    timing.wait = (float)(CORE.Time.frame - CORE.Time.update - CORE.Time.draw);
+    timing.frame = (float)CORE.Time.frame;
+
+    // Hitch reference is target frame time if set, frame time running average otherwise
+    double reference = (CORE.Time.target > 0.0)? CORE.Time.target : CORE.Time.average;
+    bool hitch = (reference > 0.0) && (CORE.Time.frame > reference*FRAME_HITCH_FACTOR);
+
+    if (CORE.Time.average <= 0.0) CORE.Time.average = CORE.Time.frame;
+    else CORE.Time.average += (CORE.Time.frame - CORE.Time.average)*0.05;
+
+    if (hitch) CORE.Time.hitches++;
+
+    CORE.Time.history[CORE.Time.historyHead] = timing;
+    CORE.Time.historyHitch[CORE.Time.historyHead] = hitch;
+    CORE.Time.historyHead = (CORE.Time.historyHead + 1)%MAX_FRAME_TIMING_HISTORY;
+    if (CORE.Time.historyCount < MAX_FRAME_TIMING_HISTORY) CORE.Time.historyCount++;
+}
+
+// Compare frame times, used to sort them
+static int CompareFrameTimes(const void *a, const void *b)
+{
+    float timeA = *(const float *)a;
+    float timeB = *(const float *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+
+// Get frame times stats, percentiles are nearest-rank values
+// NOTE: Provided times array is sorted in place
+static FrameTimeStats GetFrameTimeStats(float *times, int count)
+{
+    FrameTimeStats stats = { 0 };
+
+    qsort(times, count, sizeof(float), CompareFrameTimes);
+
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) sum += times[i];
+
+    stats.min = times[0];
+    stats.avg = (float)(sum/(double)count);
+    stats.p50 = times[(count*50 + 99)/100 - 1];
+    stats.p95 = times[(count*95 + 99)/100 - 1];
+    stats.p99 = times[(count*99 + 99)/100 - 1];
+    stats.max = times[count - 1];
+
+    return stats;
+}
+
+// Wait for frame pacer deadline, deadlines are kept on a fixed cadence from the first paced frame
+// NOTE: Next deadline is computed from the previous one, not from frame end, so wake-up errors do not accumulate
+static void WaitFrameDeadline(void)
+{
+    if (CORE.Time.deadline <= 0.0) CORE.Time.deadline = CORE.Time.current - CORE.Time.frame + CORE.Time.target;
+    else CORE.Time.deadline += CORE.Time.target;
+
+    if (CORE.Time.current >= CORE.Time.deadline)
+    {
+        // Frame took too long, cadence is kept to catch up a late frame but restarted
+        // if a whole frame was missed, to avoid a burst of frames without waiting
+        CORE.Time.missed++;
+        if ((CORE.Time.current - CORE.Time.deadline) > CORE.Time.target) CORE.Time.deadline = CORE.Time.current;
+
+        return;
+    }
+
+#if defined(SUPPORT_BUSY_WAIT_LOOP)
+    while (GetTime() < CORE.Time.deadline) { }
+#else
+    if (CORE.Time.pacing == FRAME_PACING_PRECISE)
+    {
+        // Sleep until deadline minus scheduler wake-up slack, remaining time is busy-waited
+        double wakeTime = CORE.Time.deadline - CORE.Time.slack;
+
+        if (wakeTime > CORE.Time.current)
+        {
+            SleepUntilTime(wakeTime);
+
+            // Slack self-calibration, tracks wake-up latency 95th percentile: raised by 19 steps on a late wake-up,
+            // lowered by one step otherwise, so a single late wake-up (preemption) only raises it a bit
+            double latency = GetTime() - wakeTime;
+
+            if (latency > CORE.Time.slack) CORE.Time.slack += FRAME_PACING_SLACK_STEP*19;
+            else CORE.Time.slack -= FRAME_PACING_SLACK_STEP;
+
+            if (CORE.Time.slack < 0.0) CORE.Time.slack = 0.0;
+            if (CORE.Time.slack > FRAME_PACING_MAX_SLACK) CORE.Time.slack = FRAME_PACING_MAX_SLACK;
+            if (CORE.Time.slack > CORE.Time.target*0.5) CORE.Time.slack = CORE.Time.target*0.5;
+        }
+
+        while (GetTime() < CORE.Time.deadline) { }
+    }
+    else SleepUntilTime(CORE.Time.deadline);
+#endif
+
+    CORE.Time.current = GetTime();
+    double waitTime = CORE.Time.current - CORE.Time.previous;
+    CORE.Time.previous = CORE.Time.current;
+
+    CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+
+    // Frame end error from deadline, achieved jitter is its deviation
+    double error = CORE.Time.current - CORE.Time.deadline;
+    CORE.Time.error += error;
+    CORE.Time.errorSquares += error*error;
+    CORE.Time.errorCount++;
+    if (error > CORE.Time.errorMax) CORE.Time.errorMax = error;
+}
+
+// Get simulated clock step per frame: simulated clock step, target frame time or default step
+static double GetSimulatedTimeStep(void)
+{
+    double step = SIMULATED_TIME_STEP;
+
+    if (CORE.Time.step > 0.0) step = CORE.Time.step;
+    else if (CORE.Time.target > 0.0) step = CORE.Time.target;
+
+    return step;
+}
+
+#if !defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_GAMEPAD_POLLING_THREAD)
+// Sleep until time (GetTime() base), using an absolute deadline where supported
+// NOTE: Deadline is converted once to the monotonic clock, interrupted sleeps resume to the same deadline,
+// other platforms sleep the remaining time (relative), frame pacer slack covers their coarser granularity
+static void SleepUntilTime(double time)
+{
+    double seconds = time - GetTime();
+    if (seconds <= 0.0) return;
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    struct timespec deadline = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    long long int nsec = (long long int)deadline.tv_nsec + (long long int)(seconds*1000000000.0);
+    deadline.tv_sec += (time_t)(nsec/1000000000LL);
+    deadline.tv_nsec = (long)(nsec%1000000000LL);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) continue;
+#elif defined(_WIN32)
+    Sleep((unsigned long)(seconds*1000.0));
+#elif defined(__APPLE__)
+    usleep(seconds*1000000.0);
+#else
+    struct timespec req = { 0 };
+    req.tv_sec = (time_t)seconds;
+    req.tv_nsec = (long)((seconds - (double)req.tv_sec)*1000000000.0);
+
+    while (nanosleep(&req, &req) == -1) continue;
+#endif
+}
+#endif
+
 // Set viewport for a provided width and height
 void SetupViewport(int width, int height)
 {
@@ -3781,7 +4706,10 @@ static void RecordAutomationEvent(void)
     // Checking events in current frame and save them into currentEventList
     // TODO: How important is the current frame? Could it be modified?
 
-    if (currentEventList->count == currentEventList->capacity) return;    // Security check
+    // Previous frames events are streamed in chunks, if streaming
+    if ((automationEventStream != NULL) && (currentEventList->count >= AUTOMATION_EVENTS_CHUNK_SIZE)) FlushAutomationEventStream();
+
+    if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
 
     // Keyboard input events recording
     //-------------------------------------------------------------------------------------
@@ -3800,7 +4728,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
 
         // Event type: INPUT_KEY_DOWN
         if (CORE.Input.Keyboard.currentKeyState[key])
@@ -3815,7 +4743,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
     }
     //-------------------------------------------------------------------------------------
 
@@ -3836,7 +4764,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
 
         // Event type: INPUT_MOUSE_BUTTON_DOWN
         if (CORE.Input.Mouse.currentButtonState[button])
@@ -3851,7 +4779,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
     }
 
     // Event type: INPUT_MOUSE_POSITION (only saved if changed)
@@ -3867,7 +4795,7 @@ static void RecordAutomationEvent(void)
         TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_POSITION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
         currentEventList->count++;
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
     }
 
     // Event type: INPUT_MOUSE_WHEEL_MOTION
@@ -3883,7 +4811,7 @@ static void RecordAutomationEvent(void)
         TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_WHEEL_MOTION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
         currentEventList->count++;
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
     }
     //-------------------------------------------------------------------------------------
 
@@ -3904,7 +4832,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
 
         // Event type: INPUT_TOUCH_DOWN
         if (CORE.Input.Touch.currentTouchState[id])
@@ -3919,7 +4847,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
 
         // Event type: INPUT_TOUCH_POSITION
         // TODO: It requires the id!
@@ -3938,7 +4866,7 @@ static void RecordAutomationEvent(void)
         }
         */
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
     }
     //-------------------------------------------------------------------------------------
 
@@ -3979,7 +4907,7 @@ static void RecordAutomationEvent(void)
                 currentEventList->count++;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
 
             // Event type: INPUT_GAMEPAD_BUTTON_DOWN
             if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
@@ -3994,7 +4922,7 @@ static void RecordAutomationEvent(void)
                 currentEventList->count++;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
         }
 
         for (int axis = 0; axis < MAX_GAMEPAD_AXIS; axis++)
@@ -4013,7 +4941,7 @@ static void RecordAutomationEvent(void)
                 currentEventList->count++;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
         }
     }
     //-------------------------------------------------------------------------------------
@@ -4033,11 +4961,210 @@ static void RecordAutomationEvent(void)
         TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_GESTURE | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
         currentEventList->count++;
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
     }
     //-------------------------------------------------------------------------------------
 #endif
 }
+
+// Grow automation events list capacity (x2)
+// NOTE: List events must be allocated with RL_MALLOC()/RL_CALLOC(), i.e. LoadAutomationEventList()
+static bool GrowAutomationEventList(AutomationEventList *list)
+{
+    unsigned int capacity = (list->capacity > 0)? list->capacity*2 : MAX_AUTOMATION_EVENTS;
+    AutomationEvent *events = (AutomationEvent *)RL_REALLOC(list->events, capacity*sizeof(AutomationEvent));
+
+    if (events == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: Failed to grow events list, capacity: %i", list->capacity);
+        return false;
+    }
+
+    memset(events + list->capacity, 0, (capacity - list->capacity)*sizeof(AutomationEvent));
+    list->events = events;
+    list->capacity = capacity;
+
+    return true;
+}
+
+// Write recorded events to automation events stream, list set to record to is emptied
+static void FlushAutomationEventStream(void)
+{
+    if ((automationEventStream == NULL) || (currentEventList == NULL) || (currentEventList->count == 0)) return;
+
+    if (!WriteAutomationEventsChunk(automationEventStream, currentEventList->events, currentEventList->count))
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: Failed to write events stream, events lost: %i", currentEventList->count);
+    }
+
+    currentEventList->count = 0;
+}
+
+// Write automation events binary file chunk: events count, events data size and packed events data
+static bool WriteAutomationEventsChunk(FILE *file, const AutomationEvent *events, int count)
+{
+    unsigned char *data = (unsigned char *)RL_MALLOC(8 + count*AUTOMATION_EVENT_MAX_DATA_SIZE);
+    unsigned int dataSize = (unsigned int)EncodeAutomationEvents(events, count, data + 8);
+
+    data[0] = (unsigned char)count;
+    data[1] = (unsigned char)(count >> 8);
+    data[2] = (unsigned char)(count >> 16);
+    data[3] = (unsigned char)(count >> 24);
+    data[4] = (unsigned char)dataSize;
+    data[5] = (unsigned char)(dataSize >> 8);
+    data[6] = (unsigned char)(dataSize >> 16);
+    data[7] = (unsigned char)(dataSize >> 24);
+
+    bool success = (fwrite(data, 1, 8 + dataSize, file) == (8 + dataSize));
+
+    RL_FREE(data);
+
+    return success;
+}
+
+// Pack automation events: varints, frame delta and params deltas (zig-zag) from previous event of same type
+// NOTE: Data must have space for count*AUTOMATION_EVENT_MAX_DATA_SIZE bytes
+static int EncodeAutomationEvents(const AutomationEvent *events, int count, unsigned char *data)
+{
+    int previous[ACTION_SETTARGETFPS + 1][4] = { 0 };
+    unsigned int previousFrame = 0;
+    int size = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int type = (events[i].type <= ACTION_SETTARGETFPS)? events[i].type : EVENT_NONE;
+        unsigned int values[6] = { 0 };
+        int paramCount = 0;
+
+        int frameDelta = (int)(events[i].frame - previousFrame);
+        values[0] = ((unsigned int)frameDelta << 1) ^ (unsigned int)(frameDelta >> 31);
+        previousFrame = events[i].frame;
+
+        for (int k = 0; k < 4; k++)
+        {
+            int delta = (int)((unsigned int)events[i].params[k] - (unsigned int)previous[type][k]);
+            values[2 + k] = ((unsigned int)delta << 1) ^ (unsigned int)(delta >> 31);
+            if (values[2 + k] != 0) paramCount = k + 1;
+
+            previous[type][k] = events[i].params[k];
+        }
+
+        values[1] = (type << 3) | paramCount;
+
+        for (int k = 0; k < (2 + paramCount); k++)
+        {
+            unsigned int value = values[k];
+
+            while (value >= 0x80)
+            {
+                data[size++] = (unsigned char)(value | 0x80);
+                value >>= 7;
+            }
+
+            data[size++] = (unsigned char)value;
+        }
+    }
+
+    return size;
+}
+
+// Unpack automation events, returns events count unpacked (less than requested if data is not valid)
+static int DecodeAutomationEvents(const unsigned char *data, int dataSize, AutomationEvent *events, int count)
+{
+    int previous[ACTION_SETTARGETFPS + 1][4] = { 0 };
+    unsigned int previousFrame = 0;
+    int offset = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int values[6] = { 0 };
+        int valueCount = 2;
+
+        for (int k = 0; k < valueCount; k++)
+        {
+            unsigned int value = 0;
+            int shift = 0;
+
+            do
+            {
+                if ((offset >= dataSize) || (shift > 28)) return i;
+
+                value |= (unsigned int)(data[offset] & 0x7f) << shift;
+                shift += 7;
+            } while (data[offset++] & 0x80);
+
+            values[k] = value;
+
+            if (k == 1)
+            {
+                // Type and params count
+                if (((value >> 3) > ACTION_SETTARGETFPS) || ((value & 0x7) > 4)) return i;
+                valueCount = 2 + (value & 0x7);
+            }
+        }
+
+        unsigned int type = values[1] >> 3;
+
+        previousFrame += (unsigned int)((int)(values[0] >> 1) ^ -(int)(values[0] & 1));
+        events[i].frame = previousFrame;
+        events[i].type = type;
+
+        for (int k = 0; k < 4; k++)
+        {
+            previous[type][k] = (int)((unsigned int)previous[type][k] + (unsigned int)((int)(values[2 + k] >> 1) ^ -(int)(values[2 + k] & 1)));
+            events[i].params[k] = previous[type][k];
+        }
+    }
+
+    return count;
+}
+
+// Load automation events file data, memory-mapped if supported (read-only)
+static unsigned char *LoadAutomationFileData(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(AUTOMATION_EVENTS_FILE_MMAP)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(fd, &info) == 0) && (info.st_size > 0) && (info.st_size < 0x7fffffff))
+        {
+            void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapped != MAP_FAILED)
+            {
+                data = (unsigned char *)mapped;
+                *dataSize = (int)info.st_size;
+            }
+        }
+
+        close(fd);
+    }
+
+    if (data == NULL) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+#else
+    data = LoadFileData(fileName, dataSize);
+#endif
+
+    return data;
+}
+
+// Unload automation events file data
+static void UnloadAutomationFileData(unsigned char *data, int dataSize)
+{
+    if (data == NULL) return;
+
+#if defined(AUTOMATION_EVENTS_FILE_MMAP)
+    munmap(data, (size_t)dataSize);
+#else
+    UnloadFileData(data);
+#endif
+}
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
@@ -1125,6 +1125,74 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw frame times graph, one column per frame for the last frames (up to width)
+// NOTE: Columns stack update, draw, swap and wait times, graph top is twice the median frame time
+void DrawFrameGraph(int posX, int posY, int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return;
+
+    FrameTiming *timings = (FrameTiming *)RL_MALLOC(width*sizeof(FrameTiming));
+    int count = GetFrameTimingHistory(timings, width);
+    FrameStats stats = GetFrameStats();
+
+    float range = 2.0f*stats.frame.p50;
+    if (range <= 0.0f) range = 1.0f/30.0f;
+    float scale = (float)height/range;
+
+    const Color colors[4] = { SKYBLUE, LIME, ORANGE, Fade(LIGHTGRAY, 0.5f) };  // Update, draw, swap, wait
+    float bottom = (float)(posY + height);
+
+    rlBegin(RL_LINES);
+        // Background, graph area not covered by frames
+        rlColor4ub(0, 0, 0, 128);
+        for (int x = count; x < width; x++)
+        {
+            rlVertex2f((float)(posX + x) + 0.5f, (float)posY);
+            rlVertex2f((float)(posX + x) + 0.5f, bottom);
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            float x = (float)(posX + width - count + i) + 0.5f;
+            float times[4] = { timings[i].update, timings[i].draw, timings[i].swap, timings[i].wait };
+            float y = bottom;
+
+            for (int k = 0; k < 4; k++)
+            {
+                float top = y - times[k]*scale;
+                if (top < (float)posY) top = (float)posY;
+
+                rlColor4ub(colors[k].r, colors[k].g, colors[k].b, colors[k].a);
+                rlVertex2f(x, y);
+                rlVertex2f(x, top);
+                y = top;
+            }
+
+            rlColor4ub(0, 0, 0, 128);
+            rlVertex2f(x, y);
+            rlVertex2f(x, (float)posY);
+
+            // Frames over graph range are marked on top
+            if (timings[i].frame > range)
+            {
+                rlColor4ub(RED.r, RED.g, RED.b, RED.a);
+                rlVertex2f(x, (float)posY);
+                rlVertex2f(x, (float)posY + 3.0f);
+            }
+        }
+
+        // Median frame time line
+        rlColor4ub(WHITE.r, WHITE.g, WHITE.b, 96);
+        rlVertex2f((float)posX, bottom - (float)height*0.5f);
+        rlVertex2f((float)(posX + width), bottom - (float)height*0.5f);
+    rlEnd();
+
+    RL_FREE(timings);
+
+    Color color = (stats.hitches > 0)? RED : LIME;
+    DrawText(TextFormat("%2.1f ms p99 %u hitches", stats.frame.p99*1000.0f, stats.hitches), posX + 2, posY + 2, 10, color);
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize